@@ -29,24 +29,9 @@ namespace GraphPrinter
 	
 	TSharedPtr<SDetailsView> FDetailsPanelPrinterUtils::FindNearestChildDetailsView(const TSharedPtr<SWidget>& SearchTarget)
 	{
-		TSharedPtr<SDetailsView> FoundDetailsView = nullptr;
-		
-		FWidgetPrinterUtils::EnumerateChildWidgets(
-			SearchTarget,
-			[&FoundDetailsView](const TSharedPtr<SWidget>& ChildWidget) -> bool
-			{
-				const TSharedPtr<SDetailsView> DetailsView = GP_CAST_SLATE_WIDGET(SDetailsView, ChildWidget);
-				if (DetailsView.IsValid())
-				{
-					FoundDetailsView = DetailsView;
-					return false;
-				}
-
-				return true;
-			}
+		return StaticCastSharedPtr<SDetailsView>(
+			FWidgetPrinterUtils::FindNearestChildWidget(SearchTarget, GP_SLATE_WIDGET_TYPE_NAME(SDetailsView))
 		);
-
-		return FoundDetailsView;
 	}
 
 	TSharedPtr<SDetailsView> FDetailsPanelPrinterUtils::GetActiveDetailsView()
@@ -77,24 +62,9 @@ namespace GraphPrinter
 
 	TSharedPtr<SActorDetails> FDetailsPanelPrinterUtils::FindNearestChildActorDetailsView(const TSharedPtr<SWidget>& SearchTarget)
 	{
-		TSharedPtr<SActorDetails> FoundActorDetailsView = nullptr;
-		
-		FWidgetPrinterUtils::EnumerateChildWidgets(
-			SearchTarget,
-			[&FoundActorDetailsView](const TSharedPtr<SWidget>& ChildWidget) -> bool
-			{
-				const TSharedPtr<SActorDetails> ActorDetailsView = GP_CAST_SLATE_WIDGET(SActorDetails, ChildWidget);
-				if (ActorDetailsView.IsValid())
-				{
-					FoundActorDetailsView = ActorDetailsView;
-					return false;
-				}
-
-				return true;
-			}
+		return StaticCastSharedPtr<SActorDetails>(
+			FWidgetPrinterUtils::FindNearestChildWidget(SearchTarget, GP_SLATE_WIDGET_TYPE_NAME(SActorDetails))
 		);
-
-		return FoundActorDetailsView;
 	}
 
 	TSharedPtr<SActorDetails> FDetailsPanelPrinterUtils::GetActiveActorDetailsView()
@@ -125,26 +95,11 @@ namespace GraphPrinter
 
 	TSharedPtr<SWidget> FDetailsPanelPrinterUtils::FindNearestChildSubobjectInstanceEditor(const TSharedPtr<SActorDetails>& SearchTarget)
 	{
-		TSharedPtr<SWidget> FoundSubobjectInstanceEditor = nullptr;
-
 #if UE_5_00_OR_LATER
-		FWidgetPrinterUtils::EnumerateChildWidgets(
-			SearchTarget,
-			[&FoundSubobjectInstanceEditor](const TSharedPtr<SWidget>& ChildWidget) -> bool
-			{
-				const TSharedPtr<SSubobjectInstanceEditor> SubobjectInstanceEditor = GP_CAST_SLATE_WIDGET(SSubobjectInstanceEditor, ChildWidget);
-				if (SubobjectInstanceEditor.IsValid())
-				{
-					FoundSubobjectInstanceEditor = SubobjectInstanceEditor;
-					return false;
-				}
-		
-				return true;
-			}
-		);
+		return FWidgetPrinterUtils::FindNearestChildWidget(SearchTarget, GP_SLATE_WIDGET_TYPE_NAME(SSubobjectInstanceEditor));
+#else
+		return nullptr;
 #endif
-
-		return FoundSubobjectInstanceEditor;
 	}
 
 	FVector2D FDetailsPanelPrinterUtils::GetDifferenceBetweenWidgetLocalSizeAndDesiredSize(TSharedPtr<SWidget> Widget)
@@ -2,6 +2,7 @@
 
 #include "DetailsPanelPrinter/WidgetPrinters/ActorDetailsPanelPrinter.h"
 #include "DetailsPanelPrinter/WidgetPrinters/InnerDetailsPanelPrinter.h"
+#include "WidgetPrinter/Utilities/CastSlateWidget.h"
 #include "GraphPrinterGlobals/GraphPrinterGlobals.h"
 
 #if UE_5_01_OR_LATER
@@ -31,6 +32,11 @@ TOptional<GraphPrinter::FSupportedWidget> UActorDetailsPanelPrinter::CheckIfSupp
 	return GraphPrinter::FSupportedWidget(ActorDetailsPanel.ToSharedRef(), EditingActorName, GetPriority());
 }
 
+TArray<FName> UActorDetailsPanelPrinter::GetSupportedWidgetTypeNames() const
+{
+	return { GP_SLATE_WIDGET_TYPE_NAME(SActorDetails) };
+}
+
 TSharedRef<GraphPrinter::IInnerWidgetPrinter> UActorDetailsPanelPrinter::CreatePrintModeInnerPrinter(const FSimpleDelegate& OnPrinterProcessingFinished) const
 {
 	return MakeShared<GraphPrinter::FActorDetailsPanelPrinter>(
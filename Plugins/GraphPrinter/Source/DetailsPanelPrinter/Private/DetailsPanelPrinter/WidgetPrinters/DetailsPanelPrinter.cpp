@@ -5,6 +5,7 @@
 #include "DetailsPanelPrinter/Types/PrintDetailsPanelOptions.h"
 #include "DetailsPanelPrinter/Types/RestoreDetailsPanelOptions.h"
 #include "DetailsPanelPrinter/WidgetPrinters/InnerDetailsPanelPrinter.h"
+#include "WidgetPrinter/Utilities/CastSlateWidget.h"
 #include "GraphPrinterGlobals/GraphPrinterGlobals.h"
 
 #if UE_5_01_OR_LATER
@@ -28,6 +29,11 @@ TOptional<GraphPrinter::FSupportedWidget> UDetailsPanelPrinter::CheckIfSupported
 	return GraphPrinter::FSupportedWidget(DetailsPanel.ToSharedRef(), EditingObjectName, GetPriority());
 }
 
+TArray<FName> UDetailsPanelPrinter::GetSupportedWidgetTypeNames() const
+{
+	return { GP_SLATE_WIDGET_TYPE_NAME(SDetailsView) };
+}
+
 UPrintWidgetOptions* UDetailsPanelPrinter::CreateDefaultPrintOptions(
 	const UPrintWidgetOptions::EPrintScope PrintScope,
 	const UPrintWidgetOptions::EExportMethod ExportMethod
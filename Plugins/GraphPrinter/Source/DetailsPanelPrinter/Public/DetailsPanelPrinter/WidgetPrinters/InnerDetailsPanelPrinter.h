@@ -84,6 +84,7 @@ namespace GraphPrinter
 		{
 			if (!IsValid(PrintOptions))
 			{
+				this->OnPrinterProcessingFinished.ExecuteIfBound();
 				return;
 			}
 			
@@ -92,6 +93,10 @@ namespace GraphPrinter
 			{
 				Super::PrintWidget();
 			}
+			else
+			{
+				this->OnPrinterProcessingFinished.ExecuteIfBound();
+			}
 		}
 		virtual bool CanPrintWidget() const override
 		{
@@ -214,10 +219,9 @@ namespace GraphPrinter
 			const TSharedRef<SDetailTree> DetailsTree = GetDetailTree(DetailsPanelPrinterParams.DetailsView);
 			DetailsTree->SetScrollOffset(DetailsPanelPrinterParams.ScrollOffset);
 		}
-		virtual bool WriteWidgetInfoToTextChunk() override
+		virtual bool GetWidgetInfoForTextChunk(TMap<FString, FString>& MapToWrite) override
 		{
 #ifdef WITH_TEXT_CHUNK_HELPER
-			TMap<FString, FString> MapToWrite;
 			{
 				UObject* EditingObject = GetSingleEditingObject(DetailsPanelPrinterParams.DetailsView);
 				if (!IsValid(EditingObject))
@@ -246,13 +250,7 @@ namespace GraphPrinter
 				MapToWrite.Add(DetailsPanelPrinter::TextChunkDefine::ExpansionStatesChunkKey, ExpansionStatesString);
 			}
 
-			const TSharedPtr<TextChunkHelper::ITextChunk> TextChunk = TextChunkHelper::ITextChunkHelper::Get().CreateTextChunk(WidgetPrinterParams.Filename);
-			if (!TextChunk.IsValid())
-			{
-				return false;
-			}
-			
-			return TextChunk->Write(MapToWrite);
+			return true;
 #else
 			return false;
 #endif
@@ -262,7 +260,7 @@ namespace GraphPrinter
 #ifdef WITH_TEXT_CHUNK_HELPER
 			// Reads data from png file using helper class.
 			TMap<FString, FString> MapToRead;
-			const TSharedPtr<TextChunkHelper::ITextChunk> TextChunk = TextChunkHelper::ITextChunkHelper::Get().CreateTextChunk(WidgetPrinterParams.Filename);
+			const TSharedPtr<TextChunkHelper::ITextChunk> TextChunk = TextChunkHelper::ITextChunkHelper::Get().CreateTextChunk(WidgetPrinterParams.Filename, TextChunkHelper::ETextChunkOpenMode::ReadOnly);
 			if (!TextChunk.IsValid())
 			{
 				return false;
@@ -28,6 +28,7 @@ public class GenericGraphPrinter : ModuleRules
 				"SlateCore",
 				"Engine",
 				"UnrealEd",
+				"GraphEditor",
 				"MainFrame",
 				"RenderCore",
 
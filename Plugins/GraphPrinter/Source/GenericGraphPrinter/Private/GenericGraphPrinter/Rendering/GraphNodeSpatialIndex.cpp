@@ -0,0 +1,117 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#include "GenericGraphPrinter/Rendering/GraphNodeSpatialIndex.h"
+
+namespace GraphPrinter
+{
+	namespace GraphNodeSpatialIndexInternal
+	{
+		// The maximum number of cells that one entry is registered to.
+		static constexpr int32 MaxCellsPerEntry = 64;
+
+		// The margin added to the range between two nodes, since the wire bends outward when connecting to a pin behind.
+		static constexpr float WireBoundsPadding = 256.f;
+	}
+	
+	FGraphNodeSpatialIndex::FGraphNodeSpatialIndex(const float InCellSize)
+		: CellSize(FMath::Max(InCellSize, 1.f))
+	{
+	}
+
+	void FGraphNodeSpatialIndex::Reset()
+	{
+		Entries.Reset();
+		Cells.Reset();
+		OversizedEntries.Reset();
+	}
+
+	bool FGraphNodeSpatialIndex::IsEmpty() const
+	{
+		return (Entries.Num() == 0);
+	}
+
+	void FGraphNodeSpatialIndex::AddNode(const UEdGraphNode* Node, const FSlateRect& NodeRect)
+	{
+		AddEntry(NodeRect, Node, nullptr);
+	}
+
+	void FGraphNodeSpatialIndex::AddWire(const UEdGraphNode* StartNode, const UEdGraphNode* EndNode, const FSlateRect& StartNodeRect, const FSlateRect& EndNodeRect)
+	{
+		const FSlateRect WireRect = StartNodeRect.Expand(EndNodeRect).ExtendBy(GraphNodeSpatialIndexInternal::WireBoundsPadding);
+		AddEntry(WireRect, StartNode, EndNode);
+	}
+
+	void FGraphNodeSpatialIndex::Query(const FSlateRect& Rect, TSet<const UEdGraphNode*>& OutNodes) const
+	{
+		const auto AddEntryNodes = [&](const FEntry& Entry)
+		{
+			if (!FSlateRect::DoRectanglesIntersect(Entry.Rect, Rect))
+			{
+				return;
+			}
+
+			OutNodes.Add(Entry.Node);
+			if (Entry.LinkedNode != nullptr)
+			{
+				OutNodes.Add(Entry.LinkedNode);
+			}
+		};
+		
+		const FIntRect CellRange = GetCellRange(Rect);
+		for (int32 CellY = CellRange.Min.Y; CellY <= CellRange.Max.Y; CellY++)
+		{
+			for (int32 CellX = CellRange.Min.X; CellX <= CellRange.Max.X; CellX++)
+			{
+				if (const TArray<int32>* EntryIndices = Cells.Find(FIntPoint(CellX, CellY)))
+				{
+					// The same entry may be found in several cells, but adding the nodes to the set again has no effect.
+					for (const int32 EntryIndex : *EntryIndices)
+					{
+						AddEntryNodes(Entries[EntryIndex]);
+					}
+				}
+			}
+		}
+
+		for (const int32 EntryIndex : OversizedEntries)
+		{
+			AddEntryNodes(Entries[EntryIndex]);
+		}
+	}
+
+	void FGraphNodeSpatialIndex::AddEntry(const FSlateRect& Rect, const UEdGraphNode* Node, const UEdGraphNode* LinkedNode)
+	{
+		if (Node == nullptr)
+		{
+			return;
+		}
+		
+		const int32 EntryIndex = Entries.Add(FEntry{ Rect, Node, LinkedNode });
+
+		const FIntRect CellRange = GetCellRange(Rect);
+		const int64 NumCells = static_cast<int64>(CellRange.Width() + 1) * (CellRange.Height() + 1);
+		if (NumCells > GraphNodeSpatialIndexInternal::MaxCellsPerEntry)
+		{
+			OversizedEntries.Add(EntryIndex);
+			return;
+		}
+
+		for (int32 CellY = CellRange.Min.Y; CellY <= CellRange.Max.Y; CellY++)
+		{
+			for (int32 CellX = CellRange.Min.X; CellX <= CellRange.Max.X; CellX++)
+			{
+				Cells.FindOrAdd(FIntPoint(CellX, CellY)).Add(EntryIndex);
+			}
+		}
+	}
+
+	FIntRect FGraphNodeSpatialIndex::GetCellRange(const FSlateRect& Rect) const
+	{
+		return FIntRect(
+			FMath::FloorToInt(Rect.Left / CellSize),
+			FMath::FloorToInt(Rect.Top / CellSize),
+			FMath::FloorToInt(Rect.Right / CellSize),
+			FMath::FloorToInt(Rect.Bottom / CellSize)
+		);
+	}
+}
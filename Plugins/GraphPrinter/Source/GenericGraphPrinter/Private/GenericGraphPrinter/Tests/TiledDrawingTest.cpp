@@ -0,0 +1,345 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "GenericGraphPrinter/WidgetPrinters/GenericGraphPrinter.h"
+#include "GenericGraphPrinter/WidgetPrinters/InnerGenericGraphPrinter.h"
+#include "GenericGraphPrinter/Types/PrintGraphOptions.h"
+#include "GraphPrinterGlobals/GraphPrinterGlobals.h"
+#include "GraphEditor.h"
+#include "SGraphPanel.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphSchema.h"
+#include "EdGraphNode_Comment.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GraphPrinter
+{
+	namespace TiledDrawingTest
+	{
+		// The width and height of each tile, which is less than the width of the graph so that it is split into several tiles.
+		static constexpr int32 TileSize = 512;
+
+		// The tolerance of each color channel when comparing the pixels drawn in different ways.
+		static constexpr int32 ColorTolerance = 8;
+
+		/**
+		 * A graph printer that returns the drawn pixels instead of exporting them.
+		 */
+		class FTestGraphPrinter : public FGenericGraphPrinter
+		{
+		public:
+			// Constructor.
+			explicit FTestGraphPrinter(UPrintWidgetOptions* InPrintOptions)
+				: FGenericGraphPrinter(InPrintOptions, FSimpleDelegate())
+			{
+			}
+
+			// Draws the graph editor in the same steps as printing and returns the pixels of the image.
+			bool Draw(TArray64<FColor>& OutPixels, FIntPoint& OutImageSize, bool& bOutIsDrawnInTiles)
+			{
+				if (!PrepareDrawing())
+				{
+					return false;
+				}
+
+				bool bIsDrawn = false;
+				bOutIsDrawnInTiles = ShouldDrawWidgetInTiles();
+				if (bOutIsDrawnInTiles)
+				{
+					bIsDrawn = DrawWidgetInTiles();
+					OutPixels = MoveTemp(WidgetPrinterParams.Pixels);
+					OutImageSize = WidgetPrinterParams.ImageSize;
+				}
+				else if (UTextureRenderTarget2D* RenderTarget = DrawWidgetToRenderTarget())
+				{
+					TArray<FColor> Pixels;
+					bIsDrawn = ReadRenderTargetPixelsInternal(RenderTarget, FIntRect(0, 0, RenderTarget->SizeX, RenderTarget->SizeY), Pixels);
+					OutPixels.Reset();
+					OutPixels.Append(Pixels);
+					OutImageSize = FIntPoint(RenderTarget->SizeX, RenderTarget->SizeY);
+					ReleaseRenderTargetInternal(RenderTarget);
+				}
+
+				PostDrawWidget();
+
+				return bIsDrawn;
+			}
+
+			// Prepares the drawing of the tile in the same steps as printing and returns the nodes whose widgets are painted in the tile.
+			bool CollectPaintedNodesInTile(const FIntRect& TileRect, TSet<const UEdGraphNode*>& OutPaintedNodes)
+			{
+				if (!PrepareDrawing())
+				{
+					return false;
+				}
+
+				const bool bIsDrawnInTiles = ShouldDrawWidgetInTiles();
+				if (bIsDrawnInTiles)
+				{
+					PreDrawTile(TileRect);
+
+					// The graph panel arranges only the visible node widgets when painting, so the collapsed ones are not painted.
+					const TSharedPtr<SGraphPanel>& GraphPanel = GenericGraphPrinterParams.OffscreenGraphPanel;
+					const UEdGraph* Graph = Widget->GetCurrentGraph();
+					if (GraphPanel.IsValid() && IsValid(Graph))
+					{
+						for (const UEdGraphNode* Node : Graph->Nodes)
+						{
+							const TSharedPtr<SGraphNode> NodeWidget = GraphPanel->GetNodeWidgetFromGuid(Node->NodeGuid);
+							if (NodeWidget.IsValid() && NodeWidget->GetVisibility().IsVisible())
+							{
+								OutPaintedNodes.Add(Node);
+							}
+						}
+					}
+				}
+
+				PostDrawWidget();
+
+				return bIsDrawnInTiles;
+			}
+
+		private:
+			// Finds the graph editor and calculates the drawing range in the same steps as printing.
+			bool PrepareDrawing()
+			{
+				Widget = FindTargetWidget(PrintOptions->SearchTarget);
+				if (!Widget.IsValid())
+				{
+					return false;
+				}
+
+				PreCalculateDrawSize();
+				if (!CalculateDrawSize(WidgetPrinterParams.DrawSize))
+				{
+					return false;
+				}
+				WidgetPrinterParams.DrawSize *= PrintOptions->RenderingScale;
+
+				PreDrawWidget();
+
+				return true;
+			}
+		};
+
+		// Adds a comment node of the specified range to the graph.
+		UEdGraphNode_Comment* AddCommentNode(UEdGraph* Graph, const FIntRect& NodeRect)
+		{
+			auto* CommentNode = NewObject<UEdGraphNode_Comment>(Graph, NAME_None, RF_Transient);
+			CommentNode->CreateNewGuid();
+			CommentNode->NodePosX = NodeRect.Min.X;
+			CommentNode->NodePosY = NodeRect.Min.Y;
+			CommentNode->NodeWidth = NodeRect.Width();
+			CommentNode->NodeHeight = NodeRect.Height();
+			Graph->AddNode(CommentNode, false, false);
+			return CommentNode;
+		}
+
+		// Creates a graph editor with two comment nodes that is not docked in a tab, in the same way as the commandlet.
+		// With the padding of the print options, the left node is only in the first tile and the right node is only in the second tile.
+		TSharedRef<SGraphEditor> MakeGraphEditor(UEdGraphNode_Comment** OutLeftNode = nullptr, UEdGraphNode_Comment** OutRightNode = nullptr)
+		{
+			UEdGraph* Graph = NewObject<UEdGraph>(GetTransientPackage(), NAME_None, RF_Transient);
+			Graph->Schema = UEdGraphSchema::StaticClass();
+			UEdGraphNode_Comment* LeftNode = AddCommentNode(Graph, FIntRect(0, 0, 200, 200));
+			UEdGraphNode_Comment* RightNode = AddCommentNode(Graph, FIntRect(600, 100, 800, 300));
+			if (OutLeftNode != nullptr)
+			{
+				*OutLeftNode = LeftNode;
+			}
+			if (OutRightNode != nullptr)
+			{
+				*OutRightNode = RightNode;
+			}
+
+			const TSharedRef<SGraphEditor> GraphEditor = SNew(SGraphEditor)
+				.GraphToEdit(Graph)
+				.IsEditable(false);
+
+			// Since the graph editor is never ticked, creates the node widgets and calculates their sizes immediately.
+			if (SGraphPanel* GraphPanel = GraphEditor->GetGraphPanel())
+			{
+				GraphPanel->Update();
+			}
+			GraphEditor->SlatePrepass(1.f);
+
+			return GraphEditor;
+		}
+
+		// Creates the options to print the whole graph editor to an image file without reading back asynchronously.
+		UPrintGraphOptions* MakePrintOptions(const TSharedRef<SWidget>& SearchTarget)
+		{
+			auto* PrintOptions = Cast<UPrintGraphOptions>(
+				CreateDefaultPrintOptions<UGenericGraphPrinter>(
+					UPrintWidgetOptions::EPrintScope::All,
+					UPrintWidgetOptions::EExportMethod::ImageFile
+				)
+			);
+			if (IsValid(PrintOptions))
+			{
+				PrintOptions->SearchTarget = SearchTarget;
+				PrintOptions->Padding = 50.f;
+				PrintOptions->RenderingScale = 1.f;
+				PrintOptions->bUseAsyncReadback = false;
+				PrintOptions->bCullNodesOutsideDrawingRange = false;
+				PrintOptions->TileSize = TileSize;
+
+				// Since the bitmap cannot be written while drawing, the stitched pixels are kept in memory.
+				PrintOptions->ImageWriteOptions.Format = EDesiredImageFormat::BMP;
+			}
+
+			return PrintOptions;
+		}
+
+		// Returns whether each color channel of the pixels is within the tolerance.
+		bool IsNearlySameColor(const FColor& A, const FColor& B)
+		{
+			return (
+				FMath::Abs(A.R - B.R) <= ColorTolerance &&
+				FMath::Abs(A.G - B.G) <= ColorTolerance &&
+				FMath::Abs(A.B - B.B) <= ColorTolerance &&
+				FMath::Abs(A.A - B.A) <= ColorTolerance
+			);
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FTiledDrawingStitchedTilesTest,
+	"GraphPrinter.GenericGraphPrinter.TiledDrawing.StitchedTiles",
+#if UE_5_05_OR_LATER
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter
+#else
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter
+#endif
+)
+
+bool FTiledDrawingStitchedTilesTest::RunTest(const FString& Parameters)
+{
+	using namespace GraphPrinter;
+
+	const TSharedRef<SGraphEditor> GraphEditor = TiledDrawingTest::MakeGraphEditor();
+
+	UPrintGraphOptions* TiledPrintOptions = TiledDrawingTest::MakePrintOptions(GraphEditor);
+	UPrintGraphOptions* SinglePrintOptions = TiledDrawingTest::MakePrintOptions(GraphEditor);
+	if (!TestTrue(TEXT("Created the print options"), IsValid(TiledPrintOptions) && IsValid(SinglePrintOptions)))
+	{
+		return true;
+	}
+	// The tiles are drawn with the default settings, and the result is compared with the bare graph panel drawn at once.
+	TiledPrintOptions->bEnableTiledRendering = true;
+	TiledPrintOptions->bUseOffscreenGraphPanel = false;
+	SinglePrintOptions->bEnableTiledRendering = false;
+	SinglePrintOptions->bUseOffscreenGraphPanel = true;
+
+	TArray64<FColor> TiledPixels;
+	FIntPoint TiledImageSize;
+	bool bIsTiledDrawnInTiles = false;
+	TiledDrawingTest::FTestGraphPrinter TiledPrinter(TiledPrintOptions);
+	if (!TestTrue(TEXT("Drew the graph in tiles"), TiledPrinter.Draw(TiledPixels, TiledImageSize, bIsTiledDrawnInTiles)))
+	{
+		return true;
+	}
+
+	TArray64<FColor> SinglePixels;
+	FIntPoint SingleImageSize;
+	bool bIsSingleDrawnInTiles = false;
+	TiledDrawingTest::FTestGraphPrinter SinglePrinter(SinglePrintOptions);
+	if (!TestTrue(TEXT("Drew the graph at once"), SinglePrinter.Draw(SinglePixels, SingleImageSize, bIsSingleDrawnInTiles)))
+	{
+		return true;
+	}
+
+	TestTrue(TEXT("The graph wider than the tile size is drawn in tiles"), bIsTiledDrawnInTiles);
+	TestTrue(TEXT("The image is split into two or more tiles"), TiledImageSize.X > TiledDrawingTest::TileSize);
+	TestFalse(TEXT("The graph is drawn at once when tiled drawing is disabled"), bIsSingleDrawnInTiles);
+
+	// The render target drawn at once truncates the fractional part of the draw size, while the tiles round it up.
+	const FIntPoint ComparedSize = TiledImageSize.ComponentMin(SingleImageSize);
+	TestTrue(TEXT("The image sizes differ only in rounding"), FMath::Abs(TiledImageSize.X - SingleImageSize.X) <= 1 && FMath::Abs(TiledImageSize.Y - SingleImageSize.Y) <= 1);
+
+	// If each tile drew the title bar of the graph editor, or was shifted by its height, the seams would differ from the single drawing.
+	int64 NumMismatchedPixels = 0;
+	for (int32 Y = 0; Y < ComparedSize.Y; Y++)
+	{
+		for (int32 X = 0; X < ComparedSize.X; X++)
+		{
+			const FColor& TiledPixel = TiledPixels[static_cast<int64>(Y) * TiledImageSize.X + X];
+			const FColor& SinglePixel = SinglePixels[static_cast<int64>(Y) * SingleImageSize.X + X];
+			if (!TiledDrawingTest::IsNearlySameColor(TiledPixel, SinglePixel))
+			{
+				NumMismatchedPixels++;
+			}
+		}
+	}
+	TestEqual(TEXT("The stitched tiles are the same as the single drawing"), NumMismatchedPixels, static_cast<int64>(0));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FTiledDrawingCullNodesTest,
+	"GraphPrinter.GenericGraphPrinter.TiledDrawing.CullNodes",
+#if UE_5_05_OR_LATER
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter
+#else
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter
+#endif
+)
+
+bool FTiledDrawingCullNodesTest::RunTest(const FString& Parameters)
+{
+	using namespace GraphPrinter;
+
+	UEdGraphNode_Comment* LeftNode = nullptr;
+	UEdGraphNode_Comment* RightNode = nullptr;
+	const TSharedRef<SGraphEditor> GraphEditor = TiledDrawingTest::MakeGraphEditor(&LeftNode, &RightNode);
+
+	// The culling applies with the default settings, in which the graph editor in use is printed.
+	UPrintGraphOptions* PrintOptions = TiledDrawingTest::MakePrintOptions(GraphEditor);
+	if (!TestTrue(TEXT("Created the print options"), IsValid(PrintOptions)))
+	{
+		return true;
+	}
+	PrintOptions->bEnableTiledRendering = true;
+	PrintOptions->bUseOffscreenGraphPanel = false;
+	PrintOptions->bCullNodesOutsideDrawingRange = true;
+
+	const int32 TileSize = TiledDrawingTest::TileSize;
+	{
+		TSet<const UEdGraphNode*> PaintedNodes;
+		TiledDrawingTest::FTestGraphPrinter Printer(PrintOptions);
+		if (TestTrue(TEXT("Prepared the first tile"), Printer.CollectPaintedNodesInTile(FIntRect(0, 0, TileSize, TileSize), PaintedNodes)))
+		{
+			TestTrue(TEXT("The node in the first tile is painted"), PaintedNodes.Contains(LeftNode));
+			TestFalse(TEXT("The node outside the first tile is not painted"), PaintedNodes.Contains(RightNode));
+		}
+	}
+	{
+		TSet<const UEdGraphNode*> PaintedNodes;
+		TiledDrawingTest::FTestGraphPrinter Printer(PrintOptions);
+		if (TestTrue(TEXT("Prepared the second tile"), Printer.CollectPaintedNodesInTile(FIntRect(TileSize, 0, TileSize * 2, TileSize), PaintedNodes)))
+		{
+			TestFalse(TEXT("The node outside the second tile is not painted"), PaintedNodes.Contains(LeftNode));
+			TestTrue(TEXT("The node in the second tile is painted"), PaintedNodes.Contains(RightNode));
+		}
+	}
+
+	// Only the node widgets of the graph panel built off-screen are hidden, and the graph editor in use is left as it is.
+	if (const SGraphPanel* GraphPanel = GraphEditor->GetGraphPanel())
+	{
+		for (const UEdGraphNode* Node : { LeftNode, RightNode })
+		{
+			const TSharedPtr<SGraphNode> NodeWidget = GraphPanel->GetNodeWidgetFromGuid(Node->NodeGuid);
+			TestTrue(TEXT("The node of the graph editor in use is not hidden"), NodeWidget.IsValid() && NodeWidget->GetVisibility().IsVisible());
+		}
+	}
+
+	return true;
+}
+
+#endif
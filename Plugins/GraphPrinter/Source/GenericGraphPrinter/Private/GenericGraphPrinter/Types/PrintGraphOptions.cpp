@@ -11,6 +11,8 @@ UPrintGraphOptions::UPrintGraphOptions()
 	: Super()
 	, Padding(0.f)
 	, bDrawOnlyGraph(false)
+	, bUseOffscreenGraphPanel(false)
+	, bCullNodesOutsideDrawingRange(true)
 {
 }
 
@@ -21,7 +23,19 @@ UPrintWidgetOptions* UPrintGraphOptions::Duplicate(const TSubclassOf<UPrintWidge
 	{
 		CastedDestination->Padding = Padding;
 		CastedDestination->bDrawOnlyGraph = bDrawOnlyGraph;
+		CastedDestination->bUseOffscreenGraphPanel = bUseOffscreenGraphPanel;
+		CastedDestination->bCullNodesOutsideDrawingRange = bCullNodesOutsideDrawingRange;
 	}
 	
 	return Destination;
 }
+
+FString UPrintGraphOptions::GetContentHashText() const
+{
+	FString Text = Super::GetContentHashText();
+	Text += FString::Printf(TEXT("Padding=%f\n"), Padding);
+	Text += FString::Printf(TEXT("bDrawOnlyGraph=%d\n"), bDrawOnlyGraph ? 1 : 0);
+	Text += FString::Printf(TEXT("bUseOffscreenGraphPanel=%d\n"), bUseOffscreenGraphPanel ? 1 : 0);
+	Text += FString::Printf(TEXT("bCullNodesOutsideDrawingRange=%d\n"), bCullNodesOutsideDrawingRange ? 1 : 0);
+	return Text;
+}
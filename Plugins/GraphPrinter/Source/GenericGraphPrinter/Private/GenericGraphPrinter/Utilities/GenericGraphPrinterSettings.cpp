@@ -10,6 +10,8 @@
 UGenericGraphPrinterSettings::UGenericGraphPrinterSettings()
 	: Padding(100.f)
 	, bDrawOnlyGraph(false)
+	, bUseOffscreenGraphPanel(false)
+	, bCullNodesOutsideDrawingRange(true)
 {
 }
 
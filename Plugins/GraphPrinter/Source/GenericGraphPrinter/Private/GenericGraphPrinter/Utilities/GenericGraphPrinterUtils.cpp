@@ -7,6 +7,7 @@
 #include "Framework/Application/SlateApplication.h"
 #include "SGraphEditorImpl.h"
 #include "Widgets/Text/STextBlock.h"
+#include "Widgets/SOverlay.h"
 #include "Widgets/Docking/SDockTab.h"
 
 namespace GraphPrinter
@@ -19,26 +20,9 @@ namespace GraphPrinter
 	
 	TSharedPtr<SGraphEditorImpl> FGenericGraphPrinterUtils::FindNearestChildGraphEditor(const TSharedPtr<SWidget>& SearchTarget)
 	{
-		TSharedPtr<SGraphEditorImpl> FoundGraphEditor = GP_CAST_SLATE_WIDGET(SGraphEditorImpl, SearchTarget);
-		if (!FoundGraphEditor.IsValid())
-		{
-			FWidgetPrinterUtils::EnumerateChildWidgets(
-				SearchTarget,
-				[&FoundGraphEditor](const TSharedPtr<SWidget> ChildWidget) -> bool
-				{
-					const TSharedPtr<SGraphEditorImpl> GraphEditor = GP_CAST_SLATE_WIDGET(SGraphEditorImpl, ChildWidget);
-					if (GraphEditor.IsValid())
-					{
-						FoundGraphEditor = GraphEditor;
-						return false;
-					}
-
-					return true;
-				}
-			);
-		}
-
-		return FoundGraphEditor;
+		return StaticCastSharedPtr<SGraphEditorImpl>(
+			FWidgetPrinterUtils::FindNearestChildWidget(SearchTarget, GP_SLATE_WIDGET_TYPE_NAME(SGraphEditorImpl))
+		);
 	}
 
 	TSharedPtr<SGraphEditorImpl> FGenericGraphPrinterUtils::GetActiveGraphEditor()
@@ -69,32 +53,24 @@ namespace GraphPrinter
 
 	TSharedPtr<SWidget> FGenericGraphPrinterUtils::FindNearestChildMinimap(const TSharedPtr<SWidget>& SearchTarget)
 	{
-		TSharedPtr<SWidget> FoundMinimap = Private::CastSlateWidget<SWidget>(
+		return FWidgetPrinterUtils::FindNearestChildWidget(SearchTarget, GenericGraphPrinterUtilsConstant::GraphMinimapClassName);
+	}
+
+	void FGenericGraphPrinterUtils::FindNearestChildMinimapAndOverlay(
+		const TSharedPtr<SWidget>& SearchTarget,
+		TSharedPtr<SWidget>& OutMinimap,
+		TSharedPtr<SOverlay>& OutOverlay
+	)
+	{
+		TArray<TSharedPtr<SWidget>> FoundWidgets;
+		FWidgetPrinterUtils::FindNearestChildWidgets(
 			SearchTarget,
-			GenericGraphPrinterUtilsConstant::GraphMinimapClassName
+			{ GenericGraphPrinterUtilsConstant::GraphMinimapClassName, GP_SLATE_WIDGET_TYPE_NAME(SOverlay) },
+			FoundWidgets
 		);
-		if (!FoundMinimap.IsValid())
-		{
-			FWidgetPrinterUtils::EnumerateChildWidgets(
-				SearchTarget,
-				[&FoundMinimap](const TSharedPtr<SWidget>& ChildWidget) -> bool
-				{
-					const TSharedPtr<SWidget> Minimap = Private::CastSlateWidget<SWidget>(
-						ChildWidget,
-						GenericGraphPrinterUtilsConstant::GraphMinimapClassName
-					);
-					if (Minimap.IsValid())
-					{
-						FoundMinimap = Minimap;
-						return false;
-					}
-
-					return true;
-				}
-			);
-		}
-
-		return FoundMinimap;
+		
+		OutMinimap = FoundWidgets[0];
+		OutOverlay = StaticCastSharedPtr<SOverlay>(FoundWidgets[1]);
 	}
 
 	TArray<TSharedPtr<STextBlock>> FGenericGraphPrinterUtils::GetVisibleChildTextBlocks(const TSharedPtr<SWidget>& SearchTarget)
@@ -4,6 +4,7 @@
 #include "GenericGraphPrinter/Types/PrintGraphOptions.h"
 #include "GenericGraphPrinter/Utilities/GenericGraphPrinterSettings.h"
 #include "GenericGraphPrinter/WidgetPrinters/InnerGenericGraphPrinter.h"
+#include "WidgetPrinter/Utilities/CastSlateWidget.h"
 #include "GraphPrinterGlobals/GraphPrinterGlobals.h"
 
 #if UE_5_01_OR_LATER
@@ -32,6 +33,11 @@ TOptional<GraphPrinter::FSupportedWidget> UGenericGraphPrinter::CheckIfSupported
 	return GraphPrinter::FSupportedWidget(GraphEditor.ToSharedRef(), GraphTitle, GetPriority());
 }
 
+TArray<FName> UGenericGraphPrinter::GetSupportedWidgetTypeNames() const
+{
+	return { GP_SLATE_WIDGET_TYPE_NAME(SGraphEditorImpl) };
+}
+
 UPrintWidgetOptions* UGenericGraphPrinter::CreateDefaultPrintOptions(
 	const UPrintWidgetOptions::EPrintScope PrintScope,
 	const UPrintWidgetOptions::EExportMethod ExportMethod
@@ -45,6 +51,8 @@ UPrintWidgetOptions* UGenericGraphPrinter::CreateDefaultPrintOptions(
 			
 			PrintGraphOptions->Padding = Settings.Padding;
 			PrintGraphOptions->bDrawOnlyGraph = Settings.bDrawOnlyGraph;
+			PrintGraphOptions->bUseOffscreenGraphPanel = Settings.bUseOffscreenGraphPanel;
+			PrintGraphOptions->bCullNodesOutsideDrawingRange = Settings.bCullNodesOutsideDrawingRange;
 
 			return PrintGraphOptions;
 		}
@@ -0,0 +1,66 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Layout/SlateRect.h"
+
+class UEdGraphNode;
+
+namespace GraphPrinter
+{
+	/**
+	 * A class that divides the graph space into a uniform grid and registers the ranges of nodes and wires
+	 * so that the nodes that appear in a certain range can be found without checking all nodes.
+	 */
+	class GENERICGRAPHPRINTER_API FGraphNodeSpatialIndex
+	{
+	public:
+		// Constructor.
+		explicit FGraphNodeSpatialIndex(const float InCellSize = 1024.f);
+
+		// Removes all registered nodes and wires.
+		void Reset();
+
+		// Returns whether nothing is registered.
+		bool IsEmpty() const;
+
+		// Registers the range that the node occupies.
+		void AddNode(const UEdGraphNode* Node, const FSlateRect& NodeRect);
+
+		// Registers the range that the wire connecting two nodes can pass through.
+		// Both nodes are required to draw the wire, so both are found when the range of the wire is queried.
+		void AddWire(const UEdGraphNode* StartNode, const UEdGraphNode* EndNode, const FSlateRect& StartNodeRect, const FSlateRect& EndNodeRect);
+
+		// Collects the nodes whose range or the range of whose wires intersects the specified range.
+		void Query(const FSlateRect& Rect, TSet<const UEdGraphNode*>& OutNodes) const;
+
+	private:
+		// Registers the range and the nodes that must be drawn when the range is visible.
+		void AddEntry(const FSlateRect& Rect, const UEdGraphNode* Node, const UEdGraphNode* LinkedNode);
+
+		// Returns the range of cells that overlap the specified range.
+		FIntRect GetCellRange(const FSlateRect& Rect) const;
+
+	private:
+		// A registered range and the nodes that must be drawn when it is visible.
+		struct FEntry
+		{
+			FSlateRect Rect;
+			const UEdGraphNode* Node;
+			const UEdGraphNode* LinkedNode;
+		};
+
+		// The length of one side of a cell in graph space.
+		float CellSize;
+
+		// The registered ranges.
+		TArray<FEntry> Entries;
+
+		// The indices of the entries that overlap each cell.
+		TMap<FIntPoint, TArray<int32>> Cells;
+
+		// The indices of the entries that overlap too many cells to register to each cell, such as long wires.
+		TArray<int32> OversizedEntries;
+	};
+}
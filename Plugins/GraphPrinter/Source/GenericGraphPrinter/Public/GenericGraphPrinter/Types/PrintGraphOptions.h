@@ -20,6 +20,7 @@ public:
 
 	// UPrintWidgetOptions interface.
 	virtual UPrintWidgetOptions* Duplicate(const TSubclassOf<UPrintWidgetOptions>& DestinationClass) const override;
+	virtual FString GetContentHashText() const override;
 	// End of UPrintWidgetOptions interface.
 
 public:
@@ -28,4 +29,12 @@ public:
 	
 	// Whether to hide the title bar of the graph editor and the text of the graph type in the lower right.
 	bool bDrawOnlyGraph;
+
+	// Whether to draw a graph panel built off-screen over the same graph instead of the graph editor displayed on the screen.
+	// Graphs drawn in tiles always use the graph panel built off-screen, so the title bar and the overlays are not drawn.
+	bool bUseOffscreenGraphPanel;
+
+	// Whether to hide the nodes outside the drawing range so that they are not laid out and painted.
+	// Applies to the graph panel built off-screen, which is always used when drawing in tiles.
+	bool bCullNodesOutsideDrawingRange;
 };
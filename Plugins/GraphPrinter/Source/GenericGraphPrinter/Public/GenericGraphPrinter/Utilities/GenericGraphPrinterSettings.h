@@ -23,6 +23,19 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = "Image")
 	bool bDrawOnlyGraph;
 
+	// Whether to draw a graph panel built off-screen over the same graph instead of the graph editor displayed on the screen.
+	// Graphs drawn in tiles always use the graph panel built off-screen, so the title bar and the overlays are not drawn.
+	// The camera, selection, and visibility of the graph editor in use are not changed while printing.
+	UPROPERTY(EditAnywhere, Config, Category = "Image")
+	bool bUseOffscreenGraphPanel;
+
+	// Whether to hide the nodes outside the drawing range so that they are not laid out and painted.
+	// When printing a small part of a large graph or drawing in tiles, the drawing cost depends only on the nodes in the range.
+	// Applies to the graph panel built off-screen, which is always used when drawing in tiles, since the nodes of the graph editor in use are left as they are.
+	// When the graph editor in use is drawn at once, the nodes outside its view are already skipped while painting.
+	UPROPERTY(EditAnywhere, Config, Category = "Performance")
+	bool bCullNodesOutsideDrawingRange;
+
 public:
 	// Constructor.
 	UGenericGraphPrinterSettings();
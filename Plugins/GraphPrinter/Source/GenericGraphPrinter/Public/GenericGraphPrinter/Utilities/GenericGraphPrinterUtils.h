@@ -6,6 +6,7 @@
 
 class SWidget;
 class STextBlock;
+class SOverlay;
 class SGraphEditorImpl;
 
 namespace GraphPrinter
@@ -26,6 +27,13 @@ namespace GraphPrinter
 		// What to do if GraphMinimap is installed.
 		static TSharedPtr<SWidget> FindNearestChildMinimap(const TSharedPtr<SWidget>& SearchTarget);
 
+		// Finds the minimap and the overlay that are the nearest children of SearchTarget in a single walk.
+		static void FindNearestChildMinimapAndOverlay(
+			const TSharedPtr<SWidget>& SearchTarget,
+			TSharedPtr<SWidget>& OutMinimap,
+			TSharedPtr<SOverlay>& OutOverlay
+		);
+
 		// Returns the displayed text blocks that are children of SearchTarget.
 		static TArray<TSharedPtr<STextBlock>> GetVisibleChildTextBlocks(const TSharedPtr<SWidget>& SearchTarget);
 	};
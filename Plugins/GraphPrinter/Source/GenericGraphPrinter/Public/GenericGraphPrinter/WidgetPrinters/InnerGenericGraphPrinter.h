@@ -7,8 +7,11 @@
 #include "WidgetPrinter/Utilities/WidgetPrinterUtils.h"
 #include "GenericGraphPrinter/Utilities/GenericGraphPrinterUtils.h"
 #include "GenericGraphPrinter/Types/PrintGraphOptions.h"
+#include "GenericGraphPrinter/Rendering/GraphNodeSpatialIndex.h"
 #include "GraphPrinterGlobals/GraphPrinterGlobals.h"
 #include "SGraphEditorImpl.h"
+#include "SGraphPanel.h"
+#include "SGraphNode.h"
 #include "EdGraphUtilities.h"
 #include "Widgets/Text/STextBlock.h"
 
@@ -113,13 +116,9 @@ namespace GraphPrinter
 		virtual void PreCalculateDrawSize() override
 		{
 			// Holds the node selected by the user for printing and then restoring.
+			// When printing all nodes, the range is calculated from the nodes without selecting them,
+			// since each change of the selection is notified to the details panel and the transaction system.
 			GenericGraphPrinterParams.PreviousSelectedNodes = Widget->GetSelectedNodes();
-
-			// Gets the range of the selected node and the position of the camera to use when drawing.
-			if (PrintOptions->PrintScope == UPrintWidgetOptions::EPrintScope::All)
-			{
-				Widget->SelectAllNodes();
-			}
 		}
 		virtual bool CalculateDrawSize(FVector2D& DrawSize) override
 		{
@@ -127,17 +126,61 @@ namespace GraphPrinter
 		}
 		virtual void PreDrawWidget() override
 		{
+			if (PrintOptions->PrintScope == UPrintWidgetOptions::EPrintScope::All)
+			{
+				CollectAllNodes(GenericGraphPrinterParams.NodesToPrint);
+			}
+			else
+			{
+				GenericGraphPrinterParams.NodesToPrint = Widget->GetSelectedNodes();
+			}
+
+			// When drawing the graph panel built off-screen, the graph editor in use is left as it is.
+			if (ShouldUseOffscreenGraphPanel())
+			{
+				GenericGraphPrinterParams.OffscreenGraphPanel = CreateOffscreenGraphPanel();
+			}
+
+			// Hides the nodes outside the drawing range. When drawing in tiles, the range is narrowed for each tile.
+			// Since the visibility of the node widgets may be bound to a function and cannot be restored as it was,
+			// only the node widgets of the graph panel built off-screen, which are discarded after drawing, are hidden.
+			// Since the graph panel built off-screen is always drawn in tiles, this applies to every print drawn in tiles.
+			if (PrintOptions->bCullNodesOutsideDrawingRange && GenericGraphPrinterParams.OffscreenGraphPanel.IsValid())
+			{
+				BuildNodeSpatialIndex();
+				CullNodesOutsideRange(
+					GetGraphRangeFromImageRect(
+						FIntRect(
+							0,
+							0,
+							FMath::CeilToInt(WidgetPrinterParams.DrawSize.X),
+							FMath::CeilToInt(WidgetPrinterParams.DrawSize.Y)
+						)
+					)
+				);
+			}
+
+			if (GenericGraphPrinterParams.OffscreenGraphPanel.IsValid())
+			{
+				GenericGraphPrinterParams.OffscreenGraphPanel->RestoreViewSettings(GenericGraphPrinterParams.ViewLocation, 1.f);
+				return;
+			}
+			
 			// Sets the camera position to the upper left of the drawing range and set the zoom magnification to 1:1.
 			Widget->GetViewLocation(GenericGraphPrinterParams.PreviousViewLocation, GenericGraphPrinterParams.PreviousZoomAmount);
 			Widget->SetViewLocation(GenericGraphPrinterParams.ViewLocation, 1.f);
-
-			GenericGraphPrinterParams.NodesToPrint = Widget->GetSelectedNodes();
 	
 			// Erases the drawing result so that the frame for which the node is selected does not appear.
-			Widget->ClearSelectionSet();
+			if (GenericGraphPrinterParams.PreviousSelectedNodes.Num() > 0)
+			{
+				Widget->ClearSelectionSet();
+			}
 
+			// Finds the minimap and the overlay containing the zoom magnification text without walking the graph editor twice.
+			TSharedPtr<SOverlay> Overlay;
+			FGenericGraphPrinterUtils::FindNearestChildMinimapAndOverlay(Widget, GenericGraphPrinterParams.Minimap, Overlay);
+			
 			// If there is a minimap, hides it only while drawing.
-			GenericGraphPrinterParams.Minimap = FGenericGraphPrinterUtils::FindNearestChildMinimap(Widget);
 			if (GenericGraphPrinterParams.Minimap.IsValid())
 			{
 				GenericGraphPrinterParams.PreviousMinimapVisibility = GenericGraphPrinterParams.Minimap->GetVisibility();
@@ -155,7 +198,6 @@ namespace GraphPrinter
 			// Hides zoom magnification and graph type text while drawing.
 			if (PrintOptions->bDrawOnlyGraph)
 			{
-				const TSharedPtr<SOverlay> Overlay = FWidgetPrinterUtils::FindNearestChildOverlay(Widget);
 				TArray<TSharedPtr<STextBlock>> VisibleChildTextBlocks = FGenericGraphPrinterUtils::GetVisibleChildTextBlocks(Overlay);
 				for (const TSharedPtr<STextBlock>& VisibleChildTextBlock : VisibleChildTextBlocks)
 				{
@@ -167,8 +209,54 @@ namespace GraphPrinter
 				}
 			}
 		}
+		virtual bool SupportsTiledDrawing() const override
+		{
+			return true;
+		}
+		virtual void PreDrawTile(const FIntRect& TileRect) override
+		{
+			// Moves the camera to the upper left of the tile while keeping the zoom magnification at 1:1.
+#if UE_5_06_OR_LATER
+			const FVector2f TileOffset = FVector2f(TileRect.Min) / PrintOptions->RenderingScale;
+#else
+			const FVector2D TileOffset = FVector2D(TileRect.Min) / PrintOptions->RenderingScale;
+#endif
+			if (GenericGraphPrinterParams.OffscreenGraphPanel.IsValid())
+			{
+				GenericGraphPrinterParams.OffscreenGraphPanel->RestoreViewSettings(GenericGraphPrinterParams.ViewLocation + TileOffset, 1.f);
+			}
+			else
+			{
+				Widget->SetViewLocation(GenericGraphPrinterParams.ViewLocation + TileOffset, 1.f);
+			}
+
+			if (PrintOptions->bCullNodesOutsideDrawingRange && GenericGraphPrinterParams.OffscreenGraphPanel.IsValid())
+			{
+				CullNodesOutsideRange(GetGraphRangeFromImageRect(TileRect));
+			}
+		}
+		virtual TSharedRef<SWidget> GetWidgetToDraw() const override
+		{
+			if (GenericGraphPrinterParams.OffscreenGraphPanel.IsValid())
+			{
+				return GenericGraphPrinterParams.OffscreenGraphPanel.ToSharedRef();
+			}
+
+			return Super::GetWidgetToDraw();
+		}
 		virtual void PostDrawWidget() override
 		{
+			// The nodes hidden because they were outside the drawing range belong to the graph panel built off-screen, so they are discarded with it.
+			GenericGraphPrinterParams.PreviousNodeVisibilities.Reset();
+			GenericGraphPrinterParams.NodeSpatialIndex.Reset();
+			
+			// Since nothing in the graph editor has been changed, only discards the graph panel built off-screen.
+			if (GenericGraphPrinterParams.OffscreenGraphPanel.IsValid())
+			{
+				GenericGraphPrinterParams.OffscreenGraphPanel.Reset();
+				return;
+			}
+			
 			// Restores the visibility of the title bar, zoom magnification text, and graph type text.
 			if (GenericGraphPrinterParams.Minimap.IsValid() && GenericGraphPrinterParams.PreviousMinimapVisibility.IsSet())
 			{
@@ -197,12 +285,15 @@ namespace GraphPrinter
 			Widget->SetViewLocation(GenericGraphPrinterParams.PreviousViewLocation, GenericGraphPrinterParams.PreviousZoomAmount);
 
 			// Restores the node selection status.
-			Widget->ClearSelectionSet();
-			for (const auto& SelectedNode : GenericGraphPrinterParams.PreviousSelectedNodes)
+			if (GenericGraphPrinterParams.PreviousSelectedNodes.Num() > 0)
 			{
-				if (auto* GraphNode = Cast<UEdGraphNode>(SelectedNode))
+				Widget->ClearSelectionSet();
+				for (const auto& SelectedNode : GenericGraphPrinterParams.PreviousSelectedNodes)
 				{
-					Widget->SetNodeSelection(GraphNode, true);
+					if (auto* GraphNode = Cast<UEdGraphNode>(SelectedNode))
+					{
+						Widget->SetNodeSelection(GraphNode, true);
+					}
 				}
 			}
 		}
@@ -212,7 +303,7 @@ namespace GraphPrinter
 			GetGraphTitle(Widget, Title);
 			return Title;
 		}
-		virtual bool WriteWidgetInfoToTextChunk() override
+		virtual bool GetWidgetInfoForTextChunk(TMap<FString, FString>& MapToWrite) override
 		{
 #ifdef WITH_TEXT_CHUNK_HELPER
 			FString ExportedText;
@@ -222,16 +313,8 @@ namespace GraphPrinter
 				return false;
 			}
 
-			// Writes data to png file using helper class.
-			TMap<FString, FString> MapToWrite;
 			MapToWrite.Add(GenericGraphPrinter::TextChunkDefine::PngTextChunkKey, ExportedText);
-
-			const TSharedPtr<TextChunkHelper::ITextChunk> TextChunk = TextChunkHelper::ITextChunkHelper::Get().CreateTextChunk(WidgetPrinterParams.Filename);
-			if (!TextChunk.IsValid())
-			{
-				return false;
-			}
-			return TextChunk->Write(MapToWrite);
+			return true;
 #else
 			return false;
 #endif
@@ -241,7 +324,7 @@ namespace GraphPrinter
 #ifdef WITH_TEXT_CHUNK_HELPER
 			// Reads data from png file using helper class.
 			TMap<FString, FString> MapToRead;
-			const TSharedPtr<TextChunkHelper::ITextChunk> TextChunk = TextChunkHelper::ITextChunkHelper::Get().CreateTextChunk(WidgetPrinterParams.Filename);
+			const TSharedPtr<TextChunkHelper::ITextChunk> TextChunk = TextChunkHelper::ITextChunkHelper::Get().CreateTextChunk(WidgetPrinterParams.Filename, TextChunkHelper::ETextChunkOpenMode::ReadOnly);
 			if (!TextChunk.IsValid())
 			{
 				return false;
@@ -290,6 +373,35 @@ namespace GraphPrinter
 			return false;
 #endif
 		}
+		virtual bool CalculateContentHash(FString& OutKey, FString& OutHash) override
+		{
+			UEdGraph* Graph = Widget->GetCurrentGraph();
+			if (!IsValid(Graph))
+			{
+				return false;
+			}
+
+			// The exported text of the nodes includes their positions and all properties that can change the appearance.
+			TSet<UObject*> NodesToHash;
+			if (PrintOptions->PrintScope == UPrintWidgetOptions::EPrintScope::All)
+			{
+				for (UEdGraphNode* Node : Graph->Nodes)
+				{
+					NodesToHash.Add(Node);
+				}
+			}
+			else
+			{
+				NodesToHash = Widget->GetSelectedNodes();
+			}
+
+			FString ExportedText;
+			FEdGraphUtilities::ExportNodesToText(NodesToHash, ExportedText);
+
+			OutKey = Graph->GetPathName();
+			OutHash = FExportManifest::CalculateHash(ExportedText + PrintOptions->GetContentHashText());
+			return true;
+		}
 		virtual bool ShouldAlwaysPrintAll() const override
 		{
 			return false;
@@ -301,7 +413,13 @@ namespace GraphPrinter
 		static TSharedPtr<SGraphEditorImpl> FindTargetWidgetFromSearchTarget(const TSharedPtr<SWidget>& SearchTarget)
 		{
 			const TSharedPtr<SWidget> DockingTabStack = FWidgetPrinterUtils::FindNearestParentDockingTabStack(SearchTarget);
-			return FGenericGraphPrinterUtils::FindNearestChildGraphEditor(DockingTabStack);
+			if (DockingTabStack.IsValid())
+			{
+				return FGenericGraphPrinterUtils::FindNearestChildGraphEditor(DockingTabStack);
+			}
+
+			// The graph editor that is not docked in a tab, such as one created off-screen by the commandlet, is searched from itself.
+			return FGenericGraphPrinterUtils::FindNearestChildGraphEditor(SearchTarget);
 		}
 		
 		// Returns the title from the graph in the format "[asset name]-[graph title]".
@@ -338,22 +456,240 @@ namespace GraphPrinter
 		virtual bool CalculateGraphDrawSizeAndViewLocation(FVector2D& DrawSize, FVector2D& ViewLocation)
 #endif
 		{
-			const TSet<UObject*>& SelectedNodes = Widget->GetSelectedNodes();
-			if (SelectedNodes.Num() == 0)
+			FSlateRect Bounds;
+			if (PrintOptions->PrintScope == UPrintWidgetOptions::EPrintScope::All)
 			{
-				return false;
+				if (!GetBoundsForAllNodes(Bounds, PrintOptions->Padding))
+				{
+					return false;
+				}
 			}
-
-			FSlateRect Bounds;
-			if (!Widget->GetBoundsForSelectedNodes(Bounds, PrintOptions->Padding))
+			else
 			{
-				return false;
+				const TSet<UObject*>& SelectedNodes = Widget->GetSelectedNodes();
+				if (SelectedNodes.Num() == 0)
+				{
+					return false;
+				}
+
+				if (!Widget->GetBoundsForSelectedNodes(Bounds, PrintOptions->Padding))
+				{
+					return false;
+				}
 			}
 			DrawSize = Bounds.GetSize();
 			ViewLocation = Bounds.GetTopLeft();
 
 			return true;
 		}
+
+		// Calculates the range that contains all nodes displayed in the graph editor from their positions and sizes.
+		bool GetBoundsForAllNodes(FSlateRect& Bounds, const float Padding) const
+		{
+			bool bHasAnyNode = false;
+			FVector2D MinCorner = FVector2D::ZeroVector;
+			FVector2D MaxCorner = FVector2D::ZeroVector;
+			
+			EnumerateDisplayedNodes(
+				[&](UEdGraphNode* Node, const TSharedRef<SGraphNode>& NodeWidget)
+				{
+					const FSlateRect NodeRect = GetNodeRect(Node, NodeWidget);
+					const FVector2D NodeMinCorner = FVector2D(NodeRect.GetTopLeft());
+					const FVector2D NodeMaxCorner = FVector2D(NodeRect.GetBottomRight());
+					if (bHasAnyNode)
+					{
+						MinCorner = FVector2D::Min(MinCorner, NodeMinCorner);
+						MaxCorner = FVector2D::Max(MaxCorner, NodeMaxCorner);
+					}
+					else
+					{
+						MinCorner = NodeMinCorner;
+						MaxCorner = NodeMaxCorner;
+						bHasAnyNode = true;
+					}
+				}
+			);
+			if (!bHasAnyNode)
+			{
+				return false;
+			}
+
+			Bounds = FSlateRect(
+				MinCorner.X - Padding,
+				MinCorner.Y - Padding,
+				MaxCorner.X + Padding,
+				MaxCorner.Y + Padding
+			);
+			return true;
+		}
+
+		// Returns whether to draw the graph panel built off-screen instead of the graph editor in use.
+		// When drawing in tiles, only the graph panel is drawn so that the title bar and the overlays are not repeated in each tile
+		// and the tiles are not shifted by the height of the title bar.
+		bool ShouldUseOffscreenGraphPanel() const
+		{
+			return (PrintOptions->bUseOffscreenGraphPanel || this->ShouldDrawWidgetInTiles());
+		}
+
+		// Creates a graph panel that is not displayed on the screen over the graph of the graph editor.
+		TSharedPtr<SGraphPanel> CreateOffscreenGraphPanel() const
+		{
+			UEdGraph* Graph = Widget->GetCurrentGraph();
+			if (!IsValid(Graph))
+			{
+				return nullptr;
+			}
+
+			const TSharedRef<SGraphPanel> GraphPanel = SNew(SGraphPanel)
+				.GraphObj(Graph)
+				.InitialZoomToFit(false);
+
+			// Since the graph panel is never ticked, creates the node widgets immediately.
+			GraphPanel->Update();
+
+			return GraphPanel;
+		}
+
+		// Returns the range that the node occupies in graph space.
+		static FSlateRect GetNodeRect(const UEdGraphNode* Node, const TSharedRef<SGraphNode>& NodeWidget)
+		{
+			// Uses the same position and size as when the range of the selected nodes is calculated.
+			const FVector2D NodeMinCorner = FVector2D(Node->NodePosX, Node->NodePosY);
+			const FVector2D NodeMaxCorner = NodeMinCorner + FVector2D(NodeWidget->GetDesiredSize());
+			return FSlateRect(NodeMinCorner.X, NodeMinCorner.Y, NodeMaxCorner.X, NodeMaxCorner.Y);
+		}
+
+		// Returns the range of the graph drawn in the specified range of the image.
+		FSlateRect GetGraphRangeFromImageRect(const FIntRect& ImageRect) const
+		{
+			const FVector2D ViewLocation = FVector2D(GenericGraphPrinterParams.ViewLocation);
+			const FVector2D RangeMin = ViewLocation + FVector2D(ImageRect.Min) / PrintOptions->RenderingScale;
+			const FVector2D RangeMax = ViewLocation + FVector2D(ImageRect.Max) / PrintOptions->RenderingScale;
+			return FSlateRect(RangeMin.X, RangeMin.Y, RangeMax.X, RangeMax.Y);
+		}
+
+		// Registers the ranges of the nodes and wires displayed in the graph editor in the spatial index.
+		void BuildNodeSpatialIndex()
+		{
+			FGraphNodeSpatialIndex& NodeSpatialIndex = GenericGraphPrinterParams.NodeSpatialIndex;
+			NodeSpatialIndex.Reset();
+
+			TMap<const UEdGraphNode*, FSlateRect> NodeRects;
+			EnumerateDisplayedNodes(
+				[&](UEdGraphNode* Node, const TSharedRef<SGraphNode>& NodeWidget)
+				{
+					const FSlateRect NodeRect = GetNodeRect(Node, NodeWidget);
+					NodeRects.Add(Node, NodeRect);
+					NodeSpatialIndex.AddNode(Node, NodeRect);
+				}
+			);
+
+			// Registers each wire only once from the output pin side.
+			for (const auto& NodeRect : NodeRects)
+			{
+				for (const UEdGraphPin* Pin : NodeRect.Key->Pins)
+				{
+					if ((Pin == nullptr) || (Pin->Direction != EGPD_Output))
+					{
+						continue;
+					}
+
+					for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+					{
+						if (LinkedPin == nullptr)
+						{
+							continue;
+						}
+
+						const UEdGraphNode* LinkedNode = LinkedPin->GetOwningNode();
+						if (const FSlateRect* LinkedNodeRect = NodeRects.Find(LinkedNode))
+						{
+							NodeSpatialIndex.AddWire(NodeRect.Key, LinkedNode, NodeRect.Value, *LinkedNodeRect);
+						}
+					}
+				}
+			}
+		}
+
+		// Hides the nodes of the graph panel built off-screen that neither they nor their wires intersect the range, and shows the others again.
+		void CullNodesOutsideRange(const FSlateRect& Range)
+		{
+			const UEdGraph* Graph = Widget->GetCurrentGraph();
+			const SGraphPanel* GraphPanel = GenericGraphPrinterParams.OffscreenGraphPanel.Get();
+			if (!IsValid(Graph) || (GraphPanel == nullptr) || GenericGraphPrinterParams.NodeSpatialIndex.IsEmpty())
+			{
+				return;
+			}
+
+			TSet<const UEdGraphNode*> NodesInRange;
+			GenericGraphPrinterParams.NodeSpatialIndex.Query(Range, NodesInRange);
+
+			for (const UEdGraphNode* Node : Graph->Nodes)
+			{
+				if (!IsValid(Node))
+				{
+					continue;
+				}
+
+				const TSharedPtr<SGraphNode> NodeWidget = GraphPanel->GetNodeWidgetFromGuid(Node->NodeGuid);
+				if (!NodeWidget.IsValid())
+				{
+					continue;
+				}
+
+				const EVisibility* PreviousVisibility = GenericGraphPrinterParams.PreviousNodeVisibilities.Find(NodeWidget);
+				if (PreviousVisibility == nullptr)
+				{
+					PreviousVisibility = &GenericGraphPrinterParams.PreviousNodeVisibilities.Add(NodeWidget, NodeWidget->GetVisibility());
+				}
+
+				// Collapsed widgets are skipped in both the layout and the painting.
+				const EVisibility Visibility = (NodesInRange.Contains(Node) ? *PreviousVisibility : EVisibility::Collapsed);
+				if (NodeWidget->GetVisibility() != Visibility)
+				{
+					NodeWidget->SetVisibility(Visibility);
+				}
+			}
+		}
+
+		// Collects all nodes displayed in the graph editor.
+		void CollectAllNodes(FGraphPanelSelectionSet& OutNodes) const
+		{
+			OutNodes.Reset();
+			EnumerateDisplayedNodes(
+				[&OutNodes](UEdGraphNode* Node, const TSharedRef<SGraphNode>& NodeWidget)
+				{
+					OutNodes.Add(Node);
+				}
+			);
+		}
+
+		// Enumerates the nodes of the graph that have widgets in the graph editor.
+		void EnumerateDisplayedNodes(const TFunctionRef<void(UEdGraphNode* Node, const TSharedRef<SGraphNode>& NodeWidget)>& Predicate) const
+		{
+			const UEdGraph* Graph = Widget->GetCurrentGraph();
+			const SGraphPanel* GraphPanel = Widget->GetGraphPanel();
+			if (!IsValid(Graph) || (GraphPanel == nullptr))
+			{
+				return;
+			}
+
+			for (UEdGraphNode* Node : Graph->Nodes)
+			{
+				if (!IsValid(Node))
+				{
+					continue;
+				}
+
+				const TSharedPtr<SGraphNode> NodeWidget = GraphPanel->GetNodeWidgetFromGuid(Node->NodeGuid);
+				if (!NodeWidget.IsValid())
+				{
+					continue;
+				}
+
+				Predicate(Node, NodeWidget.ToSharedRef());
+			}
+		}
 		
 	protected:
 		// A group of parameters that must be retained for processing.
@@ -392,6 +728,15 @@ namespace GraphPrinter
 
 			// The original visibility of text in graph editor overlays.
 			TMap<TSharedPtr<STextBlock>, EVisibility> PreviousChildTextBlockVisibilities;
+
+			// The graph panel that is drawn instead of the graph editor when printing off-screen.
+			TSharedPtr<SGraphPanel> OffscreenGraphPanel;
+
+			// The spatial index of the nodes and wires used to find the nodes in the drawing range.
+			FGraphNodeSpatialIndex NodeSpatialIndex;
+
+			// The visibility of the nodes of the graph panel built off-screen before they were hidden because they were outside the drawing range.
+			TMap<TSharedPtr<SGraphNode>, EVisibility> PreviousNodeVisibilities;
 		};
 		FGenericGraphPrinterParams GenericGraphPrinterParams;
 	};
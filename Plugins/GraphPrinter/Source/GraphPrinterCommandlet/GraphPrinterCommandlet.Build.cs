@@ -0,0 +1,40 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class GraphPrinterCommandlet : ModuleRules
+{
+	public GraphPrinterCommandlet(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+#if UE_5_2_OR_LATER
+		IncludeOrderVersion = EngineIncludeOrderVersion.Latest;
+#endif
+		
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+			}
+		);
+			
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"CoreUObject",
+				"Slate",
+				"SlateCore",
+				"Engine",
+				"UnrealEd",
+				"GraphEditor",
+				"RenderCore",
+				"AssetRegistry",
+				"CollectionManager",
+
+				"GraphPrinterGlobals",
+				"WidgetPrinter",
+				"GenericGraphPrinter",
+			}
+		);
+	}
+}
@@ -0,0 +1,324 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#include "GraphPrinterCommandlet/Commandlets/GraphPrinterCommandlet.h"
+#include "GraphPrinterCommandlet/Utilities/PrintableGraphDiscovery.h"
+#include "GraphPrinterCommandlet/Utilities/LazyAssetLoader.h"
+#include "GraphPrinterCommandlet/Utilities/PrintShardWorker.h"
+#include "GenericGraphPrinter/WidgetPrinters/GenericGraphPrinter.h"
+#include "GenericGraphPrinter/Types/PrintGraphOptions.h"
+#include "WidgetPrinter/IWidgetPrinterRegistry.h"
+#include "WidgetPrinter/IPrintJobQueue.h"
+#include "WidgetPrinter/Utilities/WidgetPrinterSettings.h"
+#include "WidgetPrinter/Utilities/ExportManifest.h"
+#include "GraphPrinterGlobals/GraphPrinterGlobals.h"
+#include "GraphPrinterGlobals/Utilities/GraphPrinterSettings.h"
+#include "GraphEditor.h"
+#include "SGraphPanel.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Containers/Ticker.h"
+#include "HAL/ThreadManager.h"
+#include "HAL/FileManager.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "RenderingThread.h"
+
+#if UE_5_01_OR_LATER
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GraphPrinterCommandlet)
+#endif
+
+namespace GraphPrinterCommandletInternal
+{
+	// The names of the modules of this plugin needed for printing in the order of their dependencies.
+	static const TCHAR* WidgetPrinterModuleNames[] = {
+		TEXT("GraphPrinterGlobals"),
+		TEXT("TextChunkHelper"),
+		TEXT("WidgetPrinter"),
+		TEXT("GenericGraphPrinter"),
+		TEXT("ViewportPrinter"),
+		TEXT("MaterialGraphPrinter"),
+		TEXT("ReferenceViewerPrinter"),
+	};
+
+	// The number of assets loaded and printed at once when no batch size is specified in the command line.
+	static constexpr int32 DefaultBatchSize = 8;
+
+	// The time that advances in one frame while waiting for the printing.
+	static constexpr float DeltaTime = 1.f / 60.f;
+
+	// The wall-clock seconds that one batch can take when no timeout is specified in the command line.
+	static constexpr double DefaultBatchTimeout = 600.0;
+
+	// The wall-clock seconds to wait for the graphs being printed after a batch has timed out.
+	static constexpr double CancelTimeout = 10.0;
+}
+
+UGraphPrinterCommandlet::UGraphPrinterCommandlet()
+	: bOverwriteFile(false)
+	, bSkipUnchangedExport(true)
+	, BatchTimeout(GraphPrinterCommandletInternal::DefaultBatchTimeout)
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+
+	HelpDescription = TEXT("Prints all graphs of the assets without opening the editor window.");
+	HelpUsage = TEXT("-run=GraphPrinter [-Paths=<Path>+<Path>] [-Classes=<Class>+<Class>] [-Collection=<Name>] [-AssetList=<File>] [-ResultFile=<File>] [-OutputDirectory=<Directory>] [-BatchSize=<Number>] [-BatchTimeout=<Seconds>] [-IncludeDataOnly] [-Overwrite] [-Force] -AllowCommandletRendering");
+}
+
+int32 UGraphPrinterCommandlet::Main(const FString& Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamsMap;
+	ParseCommandLine(*Params, Tokens, Switches, ParamsMap);
+
+	// The widgets are drawn with the Slate renderer, which is only available when the commandlet is allowed to render.
+	if (!FSlateApplication::IsInitialized())
+	{
+		UE_LOG(LogGraphPrinter, Error, TEXT("Slate is not initialized. Please run the commandlet with -AllowCommandletRendering."));
+		return 1;
+	}
+
+	LoadWidgetPrinterModules();
+
+	const auto& Settings = GraphPrinter::GetSettings<UWidgetPrinterSettings>();
+	if (const FString* OutputDirectoryParam = ParamsMap.Find(TEXT("OutputDirectory")))
+	{
+		OutputDirectory = FPaths::ConvertRelativePathToFull(*OutputDirectoryParam);
+	}
+	else
+	{
+		OutputDirectory = Settings.OutputDirectory.Path;
+	}
+	bOverwriteFile = (Switches.Contains(TEXT("Overwrite")) || Settings.bCanOverwriteFileWhenExport);
+	bSkipUnchangedExport = !Switches.Contains(TEXT("Force"));
+
+	int32 BatchSize = GraphPrinterCommandletInternal::DefaultBatchSize;
+	if (const FString* BatchSizeParam = ParamsMap.Find(TEXT("BatchSize")))
+	{
+		BatchSize = FMath::Max(FCString::Atoi(**BatchSizeParam), 1);
+	}
+
+	if (const FString* BatchTimeoutParam = ParamsMap.Find(TEXT("BatchTimeout")))
+	{
+		BatchTimeout = FMath::Max(FCString::Atod(**BatchTimeoutParam), 1.0);
+	}
+
+	GraphPrinter::FPrintableGraphFilter Filter;
+	if (!GraphPrinter::FPrintableGraphDiscovery::ParseFilter(Switches, ParamsMap, Filter))
+	{
+		return 1;
+	}
+
+	// The assets are listed from the asset registry, and no package is loaded until its batch is printed.
+	TArray<FAssetData> Assets;
+	if (!GraphPrinter::FPrintableGraphDiscovery::FindPrintableAssets(Filter, Assets))
+	{
+		return 1;
+	}
+	UE_LOG(LogGraphPrinter, Display, TEXT("Printing the graphs of %d assets to %s."), Assets.Num(), *OutputDirectory);
+
+	int32 NumGraphs = 0;
+	int32 NumPrintedGraphs = 0;
+	bool bIsStopped = false;
+	GraphPrinter::FLazyAssetLoader AssetLoader(Assets, BatchSize);
+	while (AssetLoader.LoadNextBatch())
+	{
+		int32 NumGraphsInBatch = 0;
+		int32 NumPrintedGraphsInBatch = 0;
+		const bool bIsBatchCompleted = PrintAssets(AssetLoader.GetCurrentBatch(), NumGraphsInBatch, NumPrintedGraphsInBatch);
+		NumGraphs += NumGraphsInBatch;
+		NumPrintedGraphs += NumPrintedGraphsInBatch;
+
+		// The printers still running use the graph editors of the batch, so the batch cannot be released and the rest cannot be printed.
+		if (!bIsBatchCompleted)
+		{
+			UE_LOG(LogGraphPrinter, Error, TEXT("Stopped printing since the graphs of the timed out batch are still being printed."));
+			bIsStopped = true;
+			break;
+		}
+		UE_LOG(LogGraphPrinter, Display, TEXT("Printed %d / %d assets."), AssetLoader.GetNumLoadedAssets(), Assets.Num());
+
+		// Releases the assets of the printed batch and the graphs created for them.
+		AssetLoader.ReleaseCurrentBatch();
+	}
+
+	// Writes the hashes of the exported graphs so that they are skipped in the next run.
+	if (GraphPrinter::FExportManifest::IsAvailable())
+	{
+		GraphPrinter::FExportManifest::Get().Flush();
+	}
+
+	// The graphs of the assets that were not loaded because the printing was stopped are counted as the assets.
+	GraphPrinter::FPrintShardResult Result;
+	Result.NumGraphs = NumGraphs;
+	Result.NumPrintedGraphs = NumPrintedGraphs;
+	Result.NumUnprintedAssets = (bIsStopped ? Assets.Num() - AssetLoader.GetNumLoadedAssets() : 0);
+
+	// Reports the result to the GraphPrinterCoordinator commandlet that launched this as a worker.
+	if (const FString* ResultFileParam = ParamsMap.Find(TEXT("ResultFile")))
+	{
+		if (!Result.SaveToFile(*ResultFileParam))
+		{
+			UE_LOG(LogGraphPrinter, Error, TEXT("Failed to write the result file : %s"), **ResultFileParam);
+			return 1;
+		}
+	}
+
+	if (Result.GetNumFailedGraphs() > 0 || bIsStopped)
+	{
+		UE_LOG(LogGraphPrinter, Error, TEXT("Failed to print %d of %d graphs of %d assets."), Result.GetNumFailedGraphs(), NumGraphs, Assets.Num());
+		return 1;
+	}
+
+	UE_LOG(LogGraphPrinter, Display, TEXT("Printed %d graphs of %d assets."), NumPrintedGraphs, Assets.Num());
+	return 0;
+}
+
+void UGraphPrinterCommandlet::LoadWidgetPrinterModules()
+{
+	FModuleManager& ModuleManager = FModuleManager::Get();
+	for (const TCHAR* ModuleName : GraphPrinterCommandletInternal::WidgetPrinterModuleNames)
+	{
+		if (ModuleManager.LoadModule(ModuleName) == nullptr)
+		{
+			UE_LOG(LogGraphPrinter, Warning, TEXT("Failed to load the module %s."), ModuleName);
+		}
+	}
+
+	// Since the editor mainframe is not created in commandlets, the printers of the loaded modules are collected here.
+	GraphPrinter::IWidgetPrinterRegistry::Get().CollectWidgetPrinters();
+}
+
+bool UGraphPrinterCommandlet::PrintAssets(const TArray<UObject*>& Assets, int32& OutNumGraphs, int32& OutNumPrintedGraphs)
+{
+	for (UObject* Asset : Assets)
+	{
+		if (!IsValid(Asset))
+		{
+			continue;
+		}
+
+		TArray<UEdGraph*> Graphs;
+		GraphPrinter::FPrintableGraphDiscovery::CollectGraphs(Asset, Graphs);
+		if (Graphs.Num() == 0)
+		{
+			continue;
+		}
+
+		// Mirrors the directory of the asset so that the assets with the same name in different directories are not mixed up.
+		const FString PackagePath = FPackageName::GetLongPackagePath(Asset->GetOutermost()->GetName());
+		const FString AssetOutputDirectory = FPaths::Combine(OutputDirectory, PackagePath.Mid(1));
+		IFileManager::Get().MakeDirectory(*AssetOutputDirectory, true);
+
+		for (UEdGraph* Graph : Graphs)
+		{
+			const TSharedRef<SGraphEditor> GraphEditor = SNew(SGraphEditor)
+				.GraphToEdit(Graph)
+				.IsEditable(false);
+
+			// Since the graph editor is never ticked, creates the node widgets and calculates their sizes immediately.
+			if (SGraphPanel* GraphPanel = GraphEditor->GetGraphPanel())
+			{
+				GraphPanel->Update();
+			}
+			GraphEditor->SlatePrepass(1.f);
+			GraphEditors.Add(GraphEditor);
+
+			UPrintWidgetOptions* PrintOptions = GraphPrinter::CreateDefaultPrintOptions<UGenericGraphPrinter>(
+				UPrintWidgetOptions::EPrintScope::All,
+				UPrintWidgetOptions::EExportMethod::ImageFile
+			);
+			if (!IsValid(PrintOptions))
+			{
+				continue;
+			}
+
+			// The graph editor is never arranged in a window, so the graph panel built for drawing is always used.
+			if (auto* PrintGraphOptions = Cast<UPrintGraphOptions>(PrintOptions))
+			{
+				PrintGraphOptions->bUseOffscreenGraphPanel = true;
+			}
+			PrintOptions->SearchTarget = GraphEditor;
+			PrintOptions->OutputDirectoryPath = AssetOutputDirectory;
+			PrintOptions->ImageWriteOptions.bOverwriteFile = bOverwriteFile;
+			PrintOptions->bSkipUnchangedExport = bSkipUnchangedExport;
+			PrintOptionsList.Add(PrintOptions);
+		}
+	}
+
+	// The batch job bounds the number of graphs being read back and written at the same time.
+	// Since the job may outlive this function when it times out, the progress is shared with the callback.
+	GraphPrinter::IPrintJobQueue& PrintJobQueue = GraphPrinter::IPrintJobQueue::Get();
+	const TSharedRef<GraphPrinter::FPrintJobProgress> Progress = MakeShared<GraphPrinter::FPrintJobProgress>();
+	const int32 JobId = PrintJobQueue.SubmitBatch(
+		PrintOptionsList,
+		GraphPrinter::EPrintJobPriority::Batch,
+		GraphPrinter::FOnPrintJobProgress::CreateLambda(
+			[Progress](const GraphPrinter::FPrintJobProgress& NewProgress)
+			{
+				*Progress = NewProgress;
+			}
+		)
+	);
+
+	const double StartTime = FPlatformTime::Seconds();
+	while (!Progress->IsCompleted() && (FPlatformTime::Seconds() - StartTime) < BatchTimeout)
+	{
+		TickEngine(GraphPrinterCommandletInternal::DeltaTime);
+	}
+
+	// Discards the graphs that have not been started and waits a little longer for the ones being printed.
+	if (!Progress->IsCompleted())
+	{
+		UE_LOG(LogGraphPrinter, Error, TEXT("The batch did not finish within %.0f seconds, so the graphs that have not been printed are treated as failed."), BatchTimeout);
+		PrintJobQueue.Cancel(JobId);
+
+		const double CancelTime = FPlatformTime::Seconds();
+		while (!Progress->IsCompleted() && (FPlatformTime::Seconds() - CancelTime) < GraphPrinterCommandletInternal::CancelTimeout)
+		{
+			TickEngine(GraphPrinterCommandletInternal::DeltaTime);
+		}
+	}
+
+	OutNumGraphs = PrintOptionsList.Num();
+	OutNumPrintedGraphs = Progress->NumSucceededWidgets;
+	if (OutNumPrintedGraphs < OutNumGraphs)
+	{
+		UE_LOG(LogGraphPrinter, Warning, TEXT("Failed to print %d of %d graphs in this batch."), OutNumGraphs - OutNumPrintedGraphs, OutNumGraphs);
+	}
+
+	if (!Progress->IsCompleted())
+	{
+		return false;
+	}
+
+	PrintOptionsList.Reset();
+	GraphEditors.Reset();
+
+	return true;
+}
+
+void UGraphPrinterCommandlet::TickEngine(const float DeltaTime)
+{
+	FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+
+#if UE_5_00_OR_LATER
+	FTSTicker::GetCoreTicker().Tick(DeltaTime);
+#else
+	FTicker::GetCoreTicker().Tick(DeltaTime);
+#endif
+	FThreadManager::Get().Tick();
+
+	// Lets the next batch be loaded while the current batch is printed.
+	ProcessAsyncLoading(true, false, DeltaTime * 0.5f);
+
+	// Lets the render thread finish the drawing and the readback that the printers are waiting for.
+	FlushRenderingCommands();
+
+	// Leaves the cores to the worker threads that are encoding the images.
+	FPlatformProcess::Sleep(0.001f);
+}
@@ -0,0 +1,269 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#include "GraphPrinterCommandlet/Commandlets/GraphPrinterCoordinatorCommandlet.h"
+#include "GraphPrinterCommandlet/Utilities/PrintableGraphDiscovery.h"
+#include "GraphPrinterCommandlet/Utilities/PrintShardWorker.h"
+#include "WidgetPrinter/Utilities/WidgetPrinterSettings.h"
+#include "GraphPrinterGlobals/GraphPrinterGlobals.h"
+#include "GraphPrinterGlobals/Utilities/GraphPrinterSettings.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMisc.h"
+#include "Misc/Paths.h"
+
+#if UE_5_01_OR_LATER
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GraphPrinterCoordinatorCommandlet)
+#endif
+
+namespace GraphPrinterCoordinatorCommandletInternal
+{
+	// The memory that one worker process is assumed to use, which limits the default number of workers.
+	// Each worker is a whole editor process that loads the assets and draws the graphs.
+	static constexpr uint32 MemoryPerWorkerGB = 4;
+
+	// The interval to check the worker processes.
+	static constexpr float PollInterval = 0.1f;
+
+	// The switches passed to the workers as they are.
+	static const TCHAR* ForwardedSwitches[] = {
+		TEXT("IncludeDataOnly"),
+		TEXT("Overwrite"),
+		TEXT("Force"),
+	};
+
+	// The parameters passed to the workers as they are.
+	// The paths and the collection are not passed since the workers only print the assets in their asset list.
+	static const TCHAR* ForwardedParams[] = {
+		TEXT("Classes"),
+		TEXT("BatchSize"),
+		TEXT("BatchTimeout"),
+	};
+
+	// Returns the number of workers used when no number is specified in the command line.
+	int32 GetDefaultNumWorkers()
+	{
+		// Leaves half of the cores to the worker threads of each process that encode and write the images.
+		const int32 NumWorkersByCores = FPlatformMisc::NumberOfCores() / 2;
+		const int32 NumWorkersByMemory = static_cast<int32>(FPlatformMemory::GetConstants().TotalPhysicalGB / MemoryPerWorkerGB);
+		return FMath::Max(FMath::Min(NumWorkersByCores, NumWorkersByMemory), 1);
+	}
+
+	// Returns the path of the asset in the form written in the asset list of the workers.
+	FString GetObjectPathString(const FAssetData& AssetData)
+	{
+#if UE_5_01_OR_LATER
+		return AssetData.GetObjectPathString();
+#else
+		return AssetData.ObjectPath.ToString();
+#endif
+	}
+}
+
+UGraphPrinterCoordinatorCommandlet::UGraphPrinterCoordinatorCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+
+	HelpDescription = TEXT("Prints all graphs of the assets with multiple worker processes running the GraphPrinter commandlet.");
+	HelpUsage = TEXT("-run=GraphPrinterCoordinator [-Workers=<Number>] [-Paths=<Path>+<Path>] [-Classes=<Class>+<Class>] [-Collection=<Name>] [-OutputDirectory=<Directory>] [-BatchSize=<Number>] [-BatchTimeout=<Seconds>] [-IncludeDataOnly] [-Overwrite] [-Force] -nullrhi");
+}
+
+int32 UGraphPrinterCoordinatorCommandlet::Main(const FString& Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamsMap;
+	ParseCommandLine(*Params, Tokens, Switches, ParamsMap);
+
+	FString OutputDirectory;
+	if (const FString* OutputDirectoryParam = ParamsMap.Find(TEXT("OutputDirectory")))
+	{
+		OutputDirectory = *OutputDirectoryParam;
+	}
+	else
+	{
+		OutputDirectory = GraphPrinter::GetSettings<UWidgetPrinterSettings>().OutputDirectory.Path;
+	}
+	OutputDirectory = FPaths::ConvertRelativePathToFull(OutputDirectory);
+
+	int32 MaxWorkers = GraphPrinterCoordinatorCommandletInternal::GetDefaultNumWorkers();
+	if (const FString* WorkersParam = ParamsMap.Find(TEXT("Workers")))
+	{
+		MaxWorkers = FMath::Max(FCString::Atoi(**WorkersParam), 1);
+	}
+
+	// The assets are listed here only once, and each worker looks up its assets by their object paths.
+	GraphPrinter::FPrintableGraphFilter Filter;
+	if (!GraphPrinter::FPrintableGraphDiscovery::ParseFilter(Switches, ParamsMap, Filter))
+	{
+		return 1;
+	}
+
+	TArray<FAssetData> Assets;
+	if (!GraphPrinter::FPrintableGraphDiscovery::FindPrintableAssets(Filter, Assets))
+	{
+		return 1;
+	}
+	if (Assets.Num() == 0)
+	{
+		UE_LOG(LogGraphPrinter, Display, TEXT("No printable assets were found."));
+		return 0;
+	}
+
+	const TArray<TArray<FString>> Shards = SplitIntoShards(Assets, MaxWorkers);
+	UE_LOG(LogGraphPrinter, Display, TEXT("Printing the graphs of %d assets to %s with %d workers."), Assets.Num(), *OutputDirectory, Shards.Num());
+
+	// The asset lists and the logs of the previous run are discarded.
+	const FString WorkingDirectory = FPaths::ConvertRelativePathToFull(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("GraphPrinter"), TEXT("Shards")));
+	IFileManager::Get().DeleteDirectory(*WorkingDirectory, false, true);
+	IFileManager::Get().MakeDirectory(*WorkingDirectory, true);
+
+	const FString WorkerParams = MakeWorkerParams(Switches, ParamsMap, OutputDirectory);
+	TArray<TUniquePtr<GraphPrinter::FPrintShardWorker>> Workers;
+	for (int32 ShardIndex = 0; ShardIndex < Shards.Num(); ShardIndex++)
+	{
+		auto Worker = MakeUnique<GraphPrinter::FPrintShardWorker>(ShardIndex, Shards[ShardIndex]);
+		if (!Worker->Launch(WorkingDirectory, WorkerParams))
+		{
+			// The workers that have already been launched are stopped when they are destroyed.
+			return 1;
+		}
+
+		Workers.Add(MoveTemp(Worker));
+	}
+
+	int32 NumRunningWorkers = Workers.Num();
+	while (NumRunningWorkers > 0)
+	{
+		FPlatformProcess::Sleep(GraphPrinterCoordinatorCommandletInternal::PollInterval);
+
+		const int32 PrevNumRunningWorkers = NumRunningWorkers;
+		NumRunningWorkers = 0;
+		for (const auto& Worker : Workers)
+		{
+			if (Worker->Tick())
+			{
+				NumRunningWorkers++;
+			}
+		}
+
+		if (NumRunningWorkers != PrevNumRunningWorkers)
+		{
+			UE_LOG(LogGraphPrinter, Display, TEXT("%d / %d workers have finished."), Workers.Num() - NumRunningWorkers, Workers.Num());
+		}
+	}
+
+	// The workers report the numbers of graphs in their result files, and the assets of the workers that did not report them are counted as failed.
+	int32 NumGraphs = 0;
+	int32 NumFailedGraphs = 0;
+	int32 NumFailedAssets = 0;
+	bool bHasFailedWorker = false;
+	for (const auto& Worker : Workers)
+	{
+		const int32 ShardIndex = Worker->GetShardIndex();
+		const int32 ReturnCode = Worker->GetReturnCode().Get(INDEX_NONE);
+		const TOptional<GraphPrinter::FPrintShardResult> Result = Worker->GetResult();
+		if (!Result.IsSet())
+		{
+			UE_LOG(LogGraphPrinter, Error, TEXT("The worker for shard %d exited with code %d without reporting the result. See Shard_%d.log in %s."), ShardIndex, ReturnCode, ShardIndex, *WorkingDirectory);
+			NumFailedAssets += Worker->GetNumAssets();
+			bHasFailedWorker = true;
+			continue;
+		}
+
+		NumGraphs += Result->NumGraphs;
+		NumFailedGraphs += Result->GetNumFailedGraphs();
+		NumFailedAssets += Result->NumUnprintedAssets;
+		if (Result->GetNumFailedGraphs() > 0 || Result->NumUnprintedAssets > 0)
+		{
+			UE_LOG(LogGraphPrinter, Error, TEXT("The worker for shard %d failed to print %d of %d graphs, and did not print %d assets. See Shard_%d.log in %s."), ShardIndex, Result->GetNumFailedGraphs(), Result->NumGraphs, Result->NumUnprintedAssets, ShardIndex, *WorkingDirectory);
+		}
+		else if (ReturnCode != 0)
+		{
+			UE_LOG(LogGraphPrinter, Error, TEXT("The worker for shard %d exited with code %d. See Shard_%d.log in %s."), ShardIndex, ReturnCode, ShardIndex, *WorkingDirectory);
+			bHasFailedWorker = true;
+		}
+	}
+
+	if (NumFailedGraphs > 0 || NumFailedAssets > 0 || bHasFailedWorker)
+	{
+		UE_LOG(LogGraphPrinter, Error, TEXT("Failed to print %d of %d graphs, and the graphs of %d of %d assets were not printed."), NumFailedGraphs, NumGraphs, NumFailedAssets, Assets.Num());
+		return 1;
+	}
+
+	UE_LOG(LogGraphPrinter, Display, TEXT("Printed %d graphs of %d assets to %s."), NumGraphs, Assets.Num(), *OutputDirectory);
+	return 0;
+}
+
+TArray<TArray<FString>> UGraphPrinterCoordinatorCommandlet::SplitIntoShards(const TArray<FAssetData>& Assets, const int32 MaxShards)
+{
+	// Each output directory has an export manifest, so the assets printed to the same directory are kept in the same shard.
+	TMap<FName, TArray<FString>> ObjectPathsByDirectory;
+	for (const FAssetData& AssetData : Assets)
+	{
+		ObjectPathsByDirectory.FindOrAdd(AssetData.PackagePath).Add(
+			GraphPrinterCoordinatorCommandletInternal::GetObjectPathString(AssetData)
+		);
+	}
+
+	TArray<TArray<FString>> Directories;
+	ObjectPathsByDirectory.GenerateValueArray(Directories);
+	Directories.Sort(
+		[](const TArray<FString>& Lhs, const TArray<FString>& Rhs) -> bool
+		{
+			return (Lhs.Num() > Rhs.Num());
+		}
+	);
+
+	// Adds the directories from the largest to the shard with the fewest assets so that the workers finish at about the same time.
+	TArray<TArray<FString>> Shards;
+	Shards.SetNum(FMath::Min(MaxShards, Directories.Num()));
+	for (const TArray<FString>& Directory : Directories)
+	{
+		TArray<FString>* SmallestShard = &Shards[0];
+		for (TArray<FString>& Shard : Shards)
+		{
+			if (Shard.Num() < SmallestShard->Num())
+			{
+				SmallestShard = &Shard;
+			}
+		}
+
+		SmallestShard->Append(Directory);
+	}
+
+	// Sorts so that the assets in the same directory are loaded together.
+	for (TArray<FString>& Shard : Shards)
+	{
+		Shard.Sort();
+	}
+
+	return Shards;
+}
+
+FString UGraphPrinterCoordinatorCommandlet::MakeWorkerParams(const TArray<FString>& Switches, const TMap<FString, FString>& ParamsMap, const FString& OutputDirectory)
+{
+	FString WorkerParams = FString::Printf(
+		TEXT("-run=GraphPrinter -OutputDirectory=\"%s\" -AllowCommandletRendering -unattended -nopause -nosplash"),
+		*OutputDirectory
+	);
+
+	for (const TCHAR* Switch : GraphPrinterCoordinatorCommandletInternal::ForwardedSwitches)
+	{
+		if (Switches.Contains(Switch))
+		{
+			WorkerParams += FString::Printf(TEXT(" -%s"), Switch);
+		}
+	}
+
+	for (const TCHAR* Key : GraphPrinterCoordinatorCommandletInternal::ForwardedParams)
+	{
+		if (const FString* Value = ParamsMap.Find(Key))
+		{
+			WorkerParams += FString::Printf(TEXT(" -%s=%s"), Key, **Value);
+		}
+	}
+
+	return WorkerParams;
+}
@@ -0,0 +1,26 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+
+namespace GraphPrinter
+{
+	class FGraphPrinterCommandletModule : public IModuleInterface
+	{
+	public:
+		// IModuleInterface interface.
+		virtual void StartupModule() override;
+		virtual void ShutdownModule() override;
+		// End of IModuleInterface interface.
+	};
+
+	void FGraphPrinterCommandletModule::StartupModule()
+	{
+	}
+
+	void FGraphPrinterCommandletModule::ShutdownModule()
+	{
+	}
+}
+
+IMPLEMENT_MODULE(GraphPrinter::FGraphPrinterCommandletModule, GraphPrinterCommandlet)
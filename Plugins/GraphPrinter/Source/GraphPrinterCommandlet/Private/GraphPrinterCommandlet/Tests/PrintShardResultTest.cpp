@@ -0,0 +1,61 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "GraphPrinterCommandlet/Utilities/PrintShardWorker.h"
+#include "GraphPrinterGlobals/GraphPrinterGlobals.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPrintShardResultFileTest,
+	"GraphPrinter.GraphPrinterCommandlet.PrintShardResult.File",
+#if UE_5_05_OR_LATER
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter
+#else
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter
+#endif
+)
+
+bool FPrintShardResultFileTest::RunTest(const FString& Parameters)
+{
+	using namespace GraphPrinter;
+
+	const FString OutputDirectory = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("GraphPrinter"), TEXT("PrintShardResult"));
+	IFileManager::Get().DeleteDirectory(*OutputDirectory, false, true);
+	IFileManager::Get().MakeDirectory(*OutputDirectory, true);
+	const FString ResultFilename = FPaths::Combine(OutputDirectory, TEXT("Shard_0.result"));
+
+	TestFalse(TEXT("The result of the worker that did not write it is not loaded"), FPrintShardResult::LoadFromFile(ResultFilename).IsSet());
+
+	FPrintShardResult Result;
+	Result.NumGraphs = 12;
+	Result.NumPrintedGraphs = 9;
+	Result.NumUnprintedAssets = 2;
+	if (!TestTrue(TEXT("Wrote the result file"), Result.SaveToFile(ResultFilename)))
+	{
+		return true;
+	}
+
+	const TOptional<FPrintShardResult> LoadedResult = FPrintShardResult::LoadFromFile(ResultFilename);
+	if (TestTrue(TEXT("Loaded the result file"), LoadedResult.IsSet()))
+	{
+		TestEqual(TEXT("The number of graphs"), LoadedResult->NumGraphs, 12);
+		TestEqual(TEXT("The number of printed graphs"), LoadedResult->NumPrintedGraphs, 9);
+		TestEqual(TEXT("The number of unprinted assets"), LoadedResult->NumUnprintedAssets, 2);
+		TestEqual(TEXT("The number of failed graphs"), LoadedResult->GetNumFailedGraphs(), 3);
+	}
+
+	// The result file cut off while the worker was writing it is not trusted.
+	FFileHelper::SaveStringToFile(TEXT("NumGraphs=12\n"), *ResultFilename);
+	TestFalse(TEXT("The incomplete result is not loaded"), FPrintShardResult::LoadFromFile(ResultFilename).IsSet());
+
+	IFileManager::Get().DeleteDirectory(*OutputDirectory, false, true);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,136 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#include "GraphPrinterCommandlet/Utilities/LazyAssetLoader.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/Package.h"
+
+namespace GraphPrinter
+{
+	FLazyAssetLoader::FLazyAssetLoader(const TArray<FAssetData>& InAssets, const int32 InBatchSize)
+		: Assets(InAssets)
+		, BatchSize(FMath::Max(InBatchSize, 1))
+		, NextBatchStartIndex(0)
+	{
+		RequestBatch(NextBatchStartIndex);
+	}
+
+	FLazyAssetLoader::~FLazyAssetLoader()
+	{
+		// Waits for the requests so that no package finishes loading after the loader is gone.
+		for (const int32 RequestId : PendingRequestIds)
+		{
+			FlushAsyncLoading(RequestId);
+		}
+	}
+
+	bool FLazyAssetLoader::LoadNextBatch()
+	{
+		if (!Assets.IsValidIndex(NextBatchStartIndex))
+		{
+			return false;
+		}
+
+		// Only waits for the packages of the next batch instead of flushing all loading.
+		for (const int32 RequestId : PendingRequestIds)
+		{
+			FlushAsyncLoading(RequestId);
+		}
+		PendingRequestIds.Reset();
+
+		CurrentBatchPackages = MoveTemp(NextBatchPackages);
+		NextBatchPackages.Reset();
+
+		CurrentBatch.Reset();
+		const int32 EndIndex = FMath::Min(NextBatchStartIndex + BatchSize, Assets.Num());
+		for (int32 Index = NextBatchStartIndex; Index < EndIndex; Index++)
+		{
+			UObject* Asset = Assets[Index].FastGetAsset(false);
+			if (!IsValid(Asset))
+			{
+				UE_LOG(LogGraphPrinter, Warning, TEXT("Failed to load %s."), *Assets[Index].PackageName.ToString());
+				continue;
+			}
+
+			CurrentBatch.Add(Asset);
+		}
+
+		NextBatchStartIndex = EndIndex;
+		RequestBatch(NextBatchStartIndex);
+
+		return true;
+	}
+
+	void FLazyAssetLoader::ReleaseCurrentBatch()
+	{
+		// The loaded assets are standalone and are never collected unless the flag is cleared.
+		// The objects still referenced from elsewhere, such as the parent classes of the next batch, are kept by the garbage collection.
+		for (UPackage* Package : CurrentBatchPackages)
+		{
+			if (!IsValid(Package) || NextBatchPackages.Contains(Package))
+			{
+				continue;
+			}
+
+			TArray<UObject*> ObjectsInPackage;
+			GetObjectsWithOuter(Package, ObjectsInPackage, true);
+			for (UObject* Object : ObjectsInPackage)
+			{
+				Object->ClearFlags(RF_Standalone);
+			}
+		}
+		CurrentBatchPackages.Reset();
+		CurrentBatch.Reset();
+
+		// Unloads the packages of the released batch and the objects created for them, such as the graph editors' graphs.
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	const TArray<UObject*>& FLazyAssetLoader::GetCurrentBatch() const
+	{
+		return CurrentBatch;
+	}
+
+	int32 FLazyAssetLoader::GetNumLoadedAssets() const
+	{
+		return NextBatchStartIndex;
+	}
+
+	void FLazyAssetLoader::AddReferencedObjects(FReferenceCollector& Collector)
+	{
+		Collector.AddReferencedObjects(CurrentBatch);
+		Collector.AddReferencedObjects(CurrentBatchPackages);
+		Collector.AddReferencedObjects(NextBatchPackages);
+	}
+
+	FString FLazyAssetLoader::GetReferencerName() const
+	{
+		return TEXT("LazyAssetLoader");
+	}
+
+	void FLazyAssetLoader::RequestBatch(const int32 StartIndex)
+	{
+		const int32 EndIndex = FMath::Min(StartIndex + BatchSize, Assets.Num());
+		for (int32 Index = StartIndex; Index < EndIndex; Index++)
+		{
+			const int32 RequestId = LoadPackageAsync(
+				Assets[Index].PackageName.ToString(),
+				FLoadPackageAsyncDelegate::CreateRaw(this, &FLazyAssetLoader::HandleOnPackageLoaded)
+			);
+			if (RequestId != INDEX_NONE)
+			{
+				PendingRequestIds.Add(RequestId);
+			}
+		}
+	}
+
+	void FLazyAssetLoader::HandleOnPackageLoaded(const FName& PackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result)
+	{
+		if (Result != EAsyncLoadingResult::Succeeded || !IsValid(LoadedPackage))
+		{
+			return;
+		}
+
+		NextBatchPackages.AddUnique(LoadedPackage);
+	}
+}
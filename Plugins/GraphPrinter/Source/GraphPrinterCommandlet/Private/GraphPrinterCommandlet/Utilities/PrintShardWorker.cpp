@@ -0,0 +1,213 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#include "GraphPrinterCommandlet/Utilities/PrintShardWorker.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+
+namespace GraphPrinter
+{
+	namespace PrintShardWorker
+	{
+		// The text contained in the lines of the output forwarded to the log of the coordinator.
+		// The rest of the output is only written to the log file of the worker.
+		static const TCHAR* ForwardedOutputMarkers[] = {
+			TEXT("LogGraphPrinter:"),
+			TEXT("Error:"),
+		};
+
+		// Returns whether the line of the output should be forwarded to the log of the coordinator.
+		bool ShouldForwardOutput(const FString& Line)
+		{
+			for (const TCHAR* Marker : ForwardedOutputMarkers)
+			{
+				if (Line.Contains(Marker))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+	}
+
+	int32 FPrintShardResult::GetNumFailedGraphs() const
+	{
+		return (NumGraphs - NumPrintedGraphs);
+	}
+
+	bool FPrintShardResult::SaveToFile(const FString& Filename) const
+	{
+		const FString Text = FString::Printf(
+			TEXT("NumGraphs=%d\nNumPrintedGraphs=%d\nNumUnprintedAssets=%d\n"),
+			NumGraphs,
+			NumPrintedGraphs,
+			NumUnprintedAssets
+		);
+		return FFileHelper::SaveStringToFile(Text, *Filename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	}
+
+	TOptional<FPrintShardResult> FPrintShardResult::LoadFromFile(const FString& Filename)
+	{
+		FString Text;
+		if (!FFileHelper::LoadFileToString(Text, *Filename))
+		{
+			return {};
+		}
+
+		FPrintShardResult Result;
+		if (!FParse::Value(*Text, TEXT("NumGraphs="), Result.NumGraphs) ||
+			!FParse::Value(*Text, TEXT("NumPrintedGraphs="), Result.NumPrintedGraphs) ||
+			!FParse::Value(*Text, TEXT("NumUnprintedAssets="), Result.NumUnprintedAssets))
+		{
+			return {};
+		}
+
+		return Result;
+	}
+
+	FPrintShardWorker::FPrintShardWorker(const int32 InShardIndex, const TArray<FString>& InObjectPaths)
+		: ShardIndex(InShardIndex)
+		, ObjectPaths(InObjectPaths)
+		, ReadPipe(nullptr)
+		, WritePipe(nullptr)
+	{
+	}
+
+	FPrintShardWorker::~FPrintShardWorker()
+	{
+		// If the coordinator is stopped before the worker exits, the worker is stopped as well so that it does not keep writing to the output directory.
+		if (ProcessHandle.IsValid())
+		{
+			if (FPlatformProcess::IsProcRunning(ProcessHandle))
+			{
+				FPlatformProcess::TerminateProc(ProcessHandle, true);
+			}
+			FPlatformProcess::CloseProc(ProcessHandle);
+		}
+
+		if (ReadPipe != nullptr || WritePipe != nullptr)
+		{
+			FPlatformProcess::ClosePipe(ReadPipe, WritePipe);
+		}
+	}
+
+	bool FPrintShardWorker::Launch(const FString& WorkingDirectory, const FString& CommandletParams)
+	{
+		const FString AssetListFilename = FPaths::Combine(WorkingDirectory, FString::Printf(TEXT("Shard_%d.txt"), ShardIndex));
+		if (!FFileHelper::SaveStringArrayToFile(ObjectPaths, *AssetListFilename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+		{
+			UE_LOG(LogGraphPrinter, Error, TEXT("Failed to write the asset list of shard %d : %s"), ShardIndex, *AssetListFilename);
+			return false;
+		}
+
+		// Each worker writes its own log file and result file since the workers run at the same time.
+		const FString LogFilename = FPaths::Combine(WorkingDirectory, FString::Printf(TEXT("Shard_%d.log"), ShardIndex));
+		ResultFilename = FPaths::Combine(WorkingDirectory, FString::Printf(TEXT("Shard_%d.result"), ShardIndex));
+		IFileManager::Get().Delete(*ResultFilename, false, true, true);
+		const FString Params = FString::Printf(
+			TEXT("\"%s\" %s -AssetList=\"%s\" -ResultFile=\"%s\" -abslog=\"%s\""),
+			*FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath()),
+			*CommandletParams,
+			*AssetListFilename,
+			*ResultFilename,
+			*LogFilename
+		);
+
+		if (!FPlatformProcess::CreatePipe(ReadPipe, WritePipe))
+		{
+			UE_LOG(LogGraphPrinter, Error, TEXT("Failed to create the pipe for shard %d."), ShardIndex);
+			return false;
+		}
+
+		ProcessHandle = FPlatformProcess::CreateProc(
+			FPlatformProcess::ExecutablePath(),
+			*Params,
+			false,
+			true,
+			true,
+			nullptr,
+			0,
+			nullptr,
+			WritePipe
+		);
+		if (!ProcessHandle.IsValid())
+		{
+			UE_LOG(LogGraphPrinter, Error, TEXT("Failed to launch the worker process for shard %d."), ShardIndex);
+			return false;
+		}
+
+		UE_LOG(LogGraphPrinter, Display, TEXT("Launched the worker process for shard %d with %d assets. The log is written to %s."), ShardIndex, ObjectPaths.Num(), *LogFilename);
+		return true;
+	}
+
+	bool FPrintShardWorker::Tick()
+	{
+		if (!ProcessHandle.IsValid() || ReturnCode.IsSet())
+		{
+			return false;
+		}
+
+		// Checks whether the process is running before reading so that the output written just before exiting is not lost.
+		const bool bIsRunning = FPlatformProcess::IsProcRunning(ProcessHandle);
+		ForwardOutput(!bIsRunning);
+		if (bIsRunning)
+		{
+			return true;
+		}
+
+		int32 ProcessReturnCode = INDEX_NONE;
+		FPlatformProcess::GetProcReturnCode(ProcessHandle, &ProcessReturnCode);
+		ReturnCode = ProcessReturnCode;
+		return false;
+	}
+
+	TOptional<int32> FPrintShardWorker::GetReturnCode() const
+	{
+		return ReturnCode;
+	}
+
+	int32 FPrintShardWorker::GetShardIndex() const
+	{
+		return ShardIndex;
+	}
+
+	int32 FPrintShardWorker::GetNumAssets() const
+	{
+		return ObjectPaths.Num();
+	}
+
+	TOptional<FPrintShardResult> FPrintShardWorker::GetResult() const
+	{
+		if (!ReturnCode.IsSet() || ResultFilename.IsEmpty())
+		{
+			return {};
+		}
+
+		return FPrintShardResult::LoadFromFile(ResultFilename);
+	}
+
+	void FPrintShardWorker::ForwardOutput(const bool bIsFinal)
+	{
+		PendingOutput += FPlatformProcess::ReadPipe(ReadPipe);
+
+		TArray<FString> Lines;
+		PendingOutput.ParseIntoArrayLines(Lines, false);
+		if (!bIsFinal && !PendingOutput.EndsWith(TEXT("\n")) && Lines.Num() > 0)
+		{
+			PendingOutput = Lines.Pop();
+		}
+		else
+		{
+			PendingOutput.Reset();
+		}
+
+		for (const FString& Line : Lines)
+		{
+			if (PrintShardWorker::ShouldForwardOutput(Line))
+			{
+				UE_LOG(LogGraphPrinter, Display, TEXT("[Shard %d] %s"), ShardIndex, *Line);
+			}
+		}
+	}
+}
@@ -0,0 +1,273 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#include "GraphPrinterCommandlet/Utilities/PrintableGraphDiscovery.h"
+#if UE_5_00_OR_LATER
+#include "AssetRegistry/AssetRegistryModule.h"
+#else
+#include "AssetRegistryModule.h"
+#endif
+#include "CollectionManagerModule.h"
+#include "ICollectionManager.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "MaterialGraph/MaterialGraph.h"
+#include "MaterialGraph/MaterialGraphSchema.h"
+#include "Materials/Material.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "UObject/UObjectHash.h"
+
+namespace GraphPrinter
+{
+	namespace PrintableGraphDiscovery
+	{
+		// The classes of the assets searched when no class is specified.
+		// The animation blueprints and the widget blueprints are included as the child classes of the blueprint.
+		static const TCHAR* DefaultClassNames[] = {
+			TEXT("Blueprint"),
+			TEXT("Material"),
+		};
+
+		// The tag written in the asset registry by the blueprints that only change the default values of the parent class.
+		static const FName IsDataOnlyTag = TEXT("IsDataOnly");
+
+		// Returns the class with the specified name, such as "Blueprint".
+		UClass* FindClassByName(const FString& ClassName)
+		{
+#if UE_5_01_OR_LATER
+			return FindFirstObject<UClass>(*ClassName, EFindFirstObjectOptions::None);
+#else
+			return FindObject<UClass>(ANY_PACKAGE, *ClassName);
+#endif
+		}
+
+		// Adds the class to the class filter of the asset registry.
+		void AddClassToFilter(FARFilter& Filter, const UClass* Class)
+		{
+#if UE_5_01_OR_LATER
+			Filter.ClassPaths.Add(Class->GetClassPathName());
+#else
+			Filter.ClassNames.Add(Class->GetFName());
+#endif
+		}
+
+		// Returns the value of the parameter split by "+" such as -Paths=/Game/A+/Game/B.
+		TArray<FString> GetListParam(const TMap<FString, FString>& ParamsMap, const TCHAR* Key)
+		{
+			TArray<FString> Values;
+			if (const FString* Param = ParamsMap.Find(Key))
+			{
+				Param->ParseIntoArray(Values, TEXT("+"));
+			}
+			return Values;
+		}
+	}
+
+	bool FPrintableGraphDiscovery::ParseFilter(const TArray<FString>& Switches, const TMap<FString, FString>& ParamsMap, FPrintableGraphFilter& OutFilter)
+	{
+		OutFilter.Paths = PrintableGraphDiscovery::GetListParam(ParamsMap, TEXT("Paths"));
+		OutFilter.ClassNames = PrintableGraphDiscovery::GetListParam(ParamsMap, TEXT("Classes"));
+		if (const FString* CollectionName = ParamsMap.Find(TEXT("Collection")))
+		{
+			OutFilter.CollectionName = FName(**CollectionName);
+		}
+		OutFilter.bIncludeDataOnlyBlueprints = Switches.Contains(TEXT("IncludeDataOnly"));
+
+		// The list of assets too long for the command line, such as the shard passed to the worker processes, is read from a file.
+		if (const FString* AssetListFilename = ParamsMap.Find(TEXT("AssetList")))
+		{
+			TArray<FString> ObjectPaths;
+			if (!FFileHelper::LoadFileToStringArray(ObjectPaths, **AssetListFilename))
+			{
+				UE_LOG(LogGraphPrinter, Error, TEXT("Failed to read the asset list : %s"), **AssetListFilename);
+				return false;
+			}
+
+			for (const FString& ObjectPath : ObjectPaths)
+			{
+				if (!ObjectPath.IsEmpty())
+				{
+					OutFilter.Paths.Add(ObjectPath);
+				}
+			}
+		}
+
+		return true;
+	}
+
+	bool FPrintableGraphDiscovery::FindPrintableAssets(const FPrintableGraphFilter& Filter, TArray<FAssetData>& OutAssets)
+	{
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		AssetRegistry.SearchAllAssets(true);
+
+		// The classes are filtered by the asset registry, so the assets of the other classes are never looked at.
+		FARFilter ClassFilter;
+		ClassFilter.bRecursiveClasses = true;
+		const TArray<FString> ClassNames = (Filter.ClassNames.Num() > 0) ? Filter.ClassNames : GetDefaultClassNames();
+		for (const FString& ClassName : ClassNames)
+		{
+			const UClass* Class = PrintableGraphDiscovery::FindClassByName(ClassName);
+			if (!IsValid(Class))
+			{
+				UE_LOG(LogGraphPrinter, Warning, TEXT("The class %s was not found."), *ClassName);
+				continue;
+			}
+
+			PrintableGraphDiscovery::AddClassToFilter(ClassFilter, Class);
+		}
+#if UE_5_01_OR_LATER
+		if (ClassFilter.ClassPaths.Num() == 0)
+#else
+		if (ClassFilter.ClassNames.Num() == 0)
+#endif
+		{
+			UE_LOG(LogGraphPrinter, Error, TEXT("None of the specified classes were found."));
+			return false;
+		}
+
+		TArray<FString> Paths = Filter.Paths;
+		if (Paths.Num() == 0 && Filter.CollectionName.IsNone())
+		{
+			Paths.Add(TEXT("/Game"));
+		}
+
+		// Since the conditions of the different fields of the filter are combined with AND, the directories and the packages are searched separately.
+		FARFilter DirectoryFilter = ClassFilter;
+		DirectoryFilter.bRecursivePaths = true;
+		FARFilter PackageFilter = ClassFilter;
+		for (const FString& Path : Paths)
+		{
+			if (FPackageName::IsValidObjectPath(Path))
+			{
+				PackageFilter.PackageNames.Add(*FPackageName::ObjectPathToPackageName(Path));
+			}
+			else if (FPackageName::DoesPackageExist(Path))
+			{
+				PackageFilter.PackageNames.Add(*Path);
+			}
+			else
+			{
+				DirectoryFilter.PackagePaths.Add(*Path);
+			}
+		}
+
+		if (!Filter.CollectionName.IsNone())
+		{
+#if UE_5_01_OR_LATER
+			TArray<FSoftObjectPath> ObjectPaths;
+#else
+			TArray<FName> ObjectPaths;
+#endif
+			ICollectionManager& CollectionManager = FCollectionManagerModule::GetModule().Get();
+			if (!CollectionManager.GetAssetsInCollection(Filter.CollectionName, ECollectionShareType::CST_All, ObjectPaths))
+			{
+				UE_LOG(LogGraphPrinter, Error, TEXT("The collection %s was not found."), *Filter.CollectionName.ToString());
+				return false;
+			}
+
+			for (const auto& ObjectPath : ObjectPaths)
+			{
+				PackageFilter.PackageNames.Add(*FPackageName::ObjectPathToPackageName(ObjectPath.ToString()));
+			}
+		}
+
+		TArray<FAssetData> FoundAssets;
+		if (DirectoryFilter.PackagePaths.Num() > 0)
+		{
+			AssetRegistry.GetAssets(DirectoryFilter, FoundAssets);
+		}
+		if (PackageFilter.PackageNames.Num() > 0)
+		{
+			TArray<FAssetData> AssetsInPackages;
+			AssetRegistry.GetAssets(PackageFilter, AssetsInPackages);
+			FoundAssets.Append(AssetsInPackages);
+		}
+
+		// The same asset may be found both in the directories and in the collection.
+		TSet<FString> AddedAssetNames;
+		for (const FAssetData& AssetData : FoundAssets)
+		{
+			if (!Filter.bIncludeDataOnlyBlueprints && IsDataOnlyBlueprint(AssetData))
+			{
+				continue;
+			}
+
+			bool bIsAlreadyAdded = false;
+			AddedAssetNames.Add(AssetData.PackageName.ToString() + TEXT(".") + AssetData.AssetName.ToString(), &bIsAlreadyAdded);
+			if (!bIsAlreadyAdded)
+			{
+				OutAssets.Add(AssetData);
+			}
+		}
+
+		// Sorts so that the assets in the same directory are loaded together and the output is the same between runs.
+		OutAssets.Sort(
+			[](const FAssetData& Lhs, const FAssetData& Rhs) -> bool
+			{
+				return (Lhs.PackageName.Compare(Rhs.PackageName) < 0);
+			}
+		);
+
+		return true;
+	}
+
+	void FPrintableGraphDiscovery::CollectGraphs(UObject* Asset, TArray<UEdGraph*>& OutGraphs)
+	{
+		if (!IsValid(Asset))
+		{
+			return;
+		}
+
+		// The material graph is not saved in the package and is only created when the material editor is opened.
+		if (auto* Material = Cast<UMaterial>(Asset))
+		{
+			if (!IsValid(Material->MaterialGraph))
+			{
+				Material->MaterialGraph = CastChecked<UMaterialGraph>(
+					FBlueprintEditorUtils::CreateNewGraph(
+						Material,
+						NAME_None,
+						UMaterialGraph::StaticClass(),
+						UMaterialGraphSchema::StaticClass()
+					)
+				);
+				Material->MaterialGraph->Material = Material;
+				Material->MaterialGraph->RebuildGraph();
+			}
+		}
+
+		// Includes the graphs nested in other graphs, such as collapsed graphs and state machines.
+		TArray<UObject*> InnerObjects;
+		GetObjectsWithOuter(Asset, InnerObjects, true);
+		for (UObject* InnerObject : InnerObjects)
+		{
+			auto* Graph = Cast<UEdGraph>(InnerObject);
+			if (!IsValid(Graph) || Graph->HasAnyFlags(RF_Transient))
+			{
+				continue;
+			}
+
+			if (Graph->GetSchema() == nullptr || Graph->Nodes.Num() == 0)
+			{
+				continue;
+			}
+
+			OutGraphs.Add(Graph);
+		}
+	}
+
+	TArray<FString> FPrintableGraphDiscovery::GetDefaultClassNames()
+	{
+		return TArray<FString>(PrintableGraphDiscovery::DefaultClassNames, UE_ARRAY_COUNT(PrintableGraphDiscovery::DefaultClassNames));
+	}
+
+	bool FPrintableGraphDiscovery::IsDataOnlyBlueprint(const FAssetData& AssetData)
+	{
+		FString IsDataOnly;
+		if (!AssetData.GetTagValue(PrintableGraphDiscovery::IsDataOnlyTag, IsDataOnly))
+		{
+			return false;
+		}
+
+		return IsDataOnly.ToBool();
+	}
+}
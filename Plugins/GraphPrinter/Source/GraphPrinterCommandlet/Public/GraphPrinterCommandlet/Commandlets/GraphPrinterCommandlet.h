@@ -0,0 +1,74 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "GraphPrinterGlobals/GraphPrinterGlobals.h"
+#include "GraphPrinterCommandlet.generated.h"
+
+class SGraphEditor;
+class UPrintWidgetOptions;
+
+/**
+ * A commandlet that prints all graphs of the assets without opening the editor window.
+ * Each graph is opened in a graph editor that is not displayed on the screen and printed by the existing widget printers.
+ * Since the widgets are drawn, it must be run with -AllowCommandletRendering.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd.exe <Project> -run=GraphPrinter [-Paths=<Path>+<Path>] [-Classes=<Class>+<Class>] [-Collection=<Name>] [-AssetList=<File>] [-ResultFile=<File>]
+ *                        [-OutputDirectory=<Directory>] [-BatchSize=<Number>] [-BatchTimeout=<Seconds>] [-IncludeDataOnly] [-Overwrite] [-Force] -AllowCommandletRendering
+ *
+ * The assets are listed from the asset registry without loading them and are loaded a few at a time while printing.
+ * The blueprints that only change the default values are skipped unless -IncludeDataOnly is specified.
+ * The graphs that have not changed since the last run are skipped unless -Force is specified.
+ * -BatchTimeout specifies the wall-clock seconds that each batch can take, and the graphs not printed by then are treated as failed.
+ * Returns a non-zero exit code if any graph failed to be printed.
+ * -AssetList specifies a file that lists the object paths of the assets line by line, and is used by the GraphPrinterCoordinator commandlet.
+ * -ResultFile specifies a file to which the numbers of printed and failed graphs are written for the GraphPrinterCoordinator commandlet.
+ */
+UCLASS()
+class UGraphPrinterCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	// Constructor.
+	UGraphPrinterCommandlet();
+
+	// UCommandlet interface.
+	virtual int32 Main(const FString& Params) override;
+	// End of UCommandlet interface.
+
+private:
+	// Loads the modules of this plugin needed for printing, since they are not loaded in commandlets.
+	static void LoadWidgetPrinterModules();
+
+	// Prints all graphs of the loaded assets and waits until all of them have been written or the batch timeout expires.
+	// OutNumPrintedGraphs is the number of graphs printed successfully, including those skipped because they have not changed.
+	// Returns false if some graphs are still being printed after the timeout, in which case the assets of the batch cannot be released.
+	bool PrintAssets(const TArray<UObject*>& Assets, int32& OutNumGraphs, int32& OutNumPrintedGraphs);
+
+	// Advances the tickers, the render thread and the async loading that the printing depends on by one frame.
+	static void TickEngine(const float DeltaTime);
+
+private:
+	// The root directory where the images are output.
+	FString OutputDirectory;
+
+	// Whether to overwrite the existing image files.
+	bool bOverwriteFile;
+
+	// Whether to skip the graphs that have not changed since they were last exported.
+	bool bSkipUnchangedExport;
+
+	// The wall-clock seconds that one batch can take before the graphs not printed are treated as failed.
+	double BatchTimeout;
+
+	// The options for printing the graphs of the current batch.
+	UPROPERTY()
+	TArray<UPrintWidgetOptions*> PrintOptionsList;
+
+	// The graph editors that are not displayed on the screen and are drawn by the printers.
+	TArray<TSharedRef<SGraphEditor>> GraphEditors;
+};
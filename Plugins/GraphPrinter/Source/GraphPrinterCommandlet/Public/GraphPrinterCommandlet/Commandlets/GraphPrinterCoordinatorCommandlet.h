@@ -0,0 +1,47 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "GraphPrinterGlobals/GraphPrinterGlobals.h"
+#if UE_5_00_OR_LATER
+#include "AssetRegistry/AssetData.h"
+#else
+#include "AssetData.h"
+#endif
+#include "GraphPrinterCoordinatorCommandlet.generated.h"
+
+/**
+ * A commandlet that splits the assets to print into shards and prints them at the same time with multiple worker processes running the GraphPrinter commandlet.
+ * Since the widgets can only be drawn on the game thread, this uses more cores than a single GraphPrinter commandlet when printing many assets.
+ * This process does not draw anything itself, so it can be run with -nullrhi, but the workers are launched with -AllowCommandletRendering.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd.exe <Project> -run=GraphPrinterCoordinator [-Workers=<Number>] [-Paths=<Path>+<Path>] [-Classes=<Class>+<Class>] [-Collection=<Name>]
+ *                        [-OutputDirectory=<Directory>] [-BatchSize=<Number>] [-BatchTimeout=<Seconds>] [-IncludeDataOnly] [-Overwrite] [-Force] -nullrhi
+ *
+ * The assets in the same directory are always printed by the same worker,
+ * so that the images and the export manifest of each output directory are written by only one process and form one output tree without being copied.
+ */
+UCLASS()
+class UGraphPrinterCoordinatorCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	// Constructor.
+	UGraphPrinterCoordinatorCommandlet();
+
+	// UCommandlet interface.
+	virtual int32 Main(const FString& Params) override;
+	// End of UCommandlet interface.
+
+private:
+	// Splits the assets into at most the specified number of shards so that the numbers of assets in the shards are as even as possible without splitting any directory.
+	// Returns the object paths of the assets in each shard.
+	static TArray<TArray<FString>> SplitIntoShards(const TArray<FAssetData>& Assets, const int32 MaxShards);
+
+	// Returns the parameters passed to all workers, which print to the same output directory with the same options as this commandlet.
+	static FString MakeWorkerParams(const TArray<FString>& Switches, const TMap<FString, FString>& ParamsMap, const FString& OutputDirectory);
+};
@@ -0,0 +1,81 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GraphPrinterGlobals/GraphPrinterGlobals.h"
+#include "UObject/GCObject.h"
+#include "UObject/UObjectGlobals.h"
+#if UE_5_00_OR_LATER
+#include "AssetRegistry/AssetData.h"
+#else
+#include "AssetData.h"
+#endif
+
+class UPackage;
+
+namespace GraphPrinter
+{
+	/**
+	 * A class that loads the assets a few at a time and releases them after they are used,
+	 * so that the memory does not grow with the number of assets.
+	 * While the current batch is used, the next batch is loaded in the background, so at most two batches are in memory at the same time.
+	 */
+	class GRAPHPRINTERCOMMANDLET_API FLazyAssetLoader : public FGCObject
+	{
+	public:
+		// Constructor.
+		FLazyAssetLoader(const TArray<FAssetData>& InAssets, const int32 InBatchSize);
+
+		// Destructor.
+		virtual ~FLazyAssetLoader() override;
+
+		// Waits for the next batch to be loaded and starts loading the batch after that.
+		// Returns false if all batches have been loaded.
+		bool LoadNextBatch();
+
+		// Releases the packages of the current batch and collects the garbage so that they are unloaded.
+		// The packages of the next batch being loaded in the background are kept.
+		void ReleaseCurrentBatch();
+
+		// Returns the loaded assets of the current batch.
+		const TArray<UObject*>& GetCurrentBatch() const;
+
+		// Returns the number of assets already returned in the batches.
+		int32 GetNumLoadedAssets() const;
+
+		// FGCObject interface.
+		virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+		virtual FString GetReferencerName() const override;
+		// End of FGCObject interface.
+
+	private:
+		// Starts loading the packages of the batch that starts at the index without blocking the game thread.
+		void RequestBatch(const int32 StartIndex);
+
+		// Called when a package of the batch being loaded in the background is loaded.
+		void HandleOnPackageLoaded(const FName& PackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result);
+
+	private:
+		// The assets to load in order.
+		TArray<FAssetData> Assets;
+
+		// The number of assets loaded at once.
+		int32 BatchSize;
+
+		// The index of the first asset of the batch being loaded in the background.
+		int32 NextBatchStartIndex;
+
+		// The ids of the requests to load the packages of the batch being loaded in the background.
+		TArray<int32> PendingRequestIds;
+
+		// The loaded assets of the current batch.
+		TArray<UObject*> CurrentBatch;
+
+		// The packages of the current batch that are unloaded when the batch is released.
+		TArray<UPackage*> CurrentBatchPackages;
+
+		// The packages of the batch being loaded in the background, which are referenced so that they are not unloaded with the current batch.
+		TArray<UPackage*> NextBatchPackages;
+	};
+}
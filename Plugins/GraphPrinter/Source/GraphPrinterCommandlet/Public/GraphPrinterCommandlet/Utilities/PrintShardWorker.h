@@ -0,0 +1,97 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GraphPrinterGlobals/GraphPrinterGlobals.h"
+#include "HAL/PlatformProcess.h"
+
+namespace GraphPrinter
+{
+	/**
+	 * A struct that holds the result of the GraphPrinter commandlet reported to the coordinator.
+	 */
+	struct GRAPHPRINTERCOMMANDLET_API FPrintShardResult
+	{
+	public:
+		// The number of graphs of the assets that were loaded.
+		int32 NumGraphs = 0;
+
+		// The number of graphs printed successfully, including those skipped because they have not changed.
+		int32 NumPrintedGraphs = 0;
+
+		// The number of assets that were not loaded because the printing was stopped.
+		int32 NumUnprintedAssets = 0;
+
+	public:
+		// Returns the number of graphs that failed to be printed.
+		int32 GetNumFailedGraphs() const;
+
+		// Writes-Reads the result to the file passed to the worker.
+		bool SaveToFile(const FString& Filename) const;
+		static TOptional<FPrintShardResult> LoadFromFile(const FString& Filename);
+	};
+
+	/**
+	 * A class that prints a part of the assets in a separate process running the GraphPrinter commandlet,
+	 * so that the drawing of the widgets, which is limited to the game thread of one process, is spread over multiple cores.
+	 * The assets are passed in a file since the list can be too long for the command line.
+	 */
+	class GRAPHPRINTERCOMMANDLET_API FPrintShardWorker
+	{
+	public:
+		// Constructor.
+		FPrintShardWorker(const int32 InShardIndex, const TArray<FString>& InObjectPaths);
+
+		// Destructor.
+		~FPrintShardWorker();
+
+		// Writes the asset list to the directory and starts the worker process with the parameters of the GraphPrinter commandlet.
+		bool Launch(const FString& WorkingDirectory, const FString& CommandletParams);
+
+		// Forwards the output of the worker process to the log and returns whether the process is still running.
+		bool Tick();
+
+		// Returns the exit code of the worker process, or an unset value if it has not exited.
+		TOptional<int32> GetReturnCode() const;
+
+		// Returns the index of the shard printed by the worker.
+		int32 GetShardIndex() const;
+
+		// Returns the number of assets printed by the worker.
+		int32 GetNumAssets() const;
+
+		// Returns the result reported by the worker, or an unset value if it exited without reporting it.
+		TOptional<FPrintShardResult> GetResult() const;
+
+	private:
+		// Logs the lines of the output written by the GraphPrinter commandlet.
+		// The incomplete last line is kept until the rest is read, unless the process has exited.
+		void ForwardOutput(const bool bIsFinal);
+
+	private:
+		// The index of the shard printed by the worker.
+		int32 ShardIndex;
+
+		// The object paths of the assets printed by the worker.
+		TArray<FString> ObjectPaths;
+
+		// The file to which the worker writes its result.
+		FString ResultFilename;
+
+		// The handle of the worker process.
+		FProcHandle ProcessHandle;
+
+		// The pipe from which the output of the worker process is read.
+		void* ReadPipe;
+
+		// The pipe to which the worker process writes its output.
+		void* WritePipe;
+
+		// The output that has been read but does not end with a new line yet.
+		FString PendingOutput;
+
+		// The exit code of the worker process.
+		TOptional<int32> ReturnCode;
+	};
+}
@@ -0,0 +1,61 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GraphPrinterGlobals/GraphPrinterGlobals.h"
+#if UE_5_00_OR_LATER
+#include "AssetRegistry/AssetData.h"
+#else
+#include "AssetData.h"
+#endif
+
+class UEdGraph;
+
+namespace GraphPrinter
+{
+	// The conditions of the assets to find the printable graphs.
+	struct GRAPHPRINTERCOMMANDLET_API FPrintableGraphFilter
+	{
+	public:
+		// The directories, packages or object paths to search.
+		// The object paths listed in the file specified by -AssetList are also added here.
+		TArray<FString> Paths;
+
+		// The name of the collection whose assets are searched.
+		FName CollectionName = NAME_None;
+
+		// The names of the asset classes to search, such as "Blueprint". The child classes are also included.
+		TArray<FString> ClassNames;
+
+		// Whether to include the blueprints that only change the default values of the parent class.
+		bool bIncludeDataOnlyBlueprints = false;
+	};
+
+	/**
+	 * A class that lists the assets that have printable graphs only from the asset registry without loading their packages,
+	 * and collects the graphs to print from the assets after they are loaded.
+	 */
+	class GRAPHPRINTERCOMMANDLET_API FPrintableGraphDiscovery
+	{
+	public:
+		// Creates the filter from the parameters of the commandlet, such as -Paths and -Classes.
+		// Returns false if the file specified by -AssetList could not be read.
+		static bool ParseFilter(const TArray<FString>& Switches, const TMap<FString, FString>& ParamsMap, FPrintableGraphFilter& OutFilter);
+
+		// Finds the assets that match the filter from the tags in the asset registry.
+		// The assets are sorted by package name so that the assets in the same directory are loaded together.
+		static bool FindPrintableAssets(const FPrintableGraphFilter& Filter, TArray<FAssetData>& OutAssets);
+
+		// Collects the graphs that the loaded asset has, including the graphs nested in other graphs.
+		// The graphs that are only created by the asset editor, such as the material graph, are created here.
+		static void CollectGraphs(UObject* Asset, TArray<UEdGraph*>& OutGraphs);
+
+		// Returns the default names of the asset classes to search.
+		static TArray<FString> GetDefaultClassNames();
+
+	private:
+		// Returns whether the asset is a blueprint that only changes the default values of the parent class.
+		static bool IsDataOnlyBlueprint(const FAssetData& AssetData);
+	};
+}
@@ -3,6 +3,7 @@
 #include "GraphPrinterEditorExtension/CommandActions/GraphPrinterCommandActions.h"
 #include "GraphPrinterGlobals/Utilities/GraphPrinterUtils.h"
 #include "WidgetPrinter/IWidgetPrinterRegistry.h"
+#include "WidgetPrinter/IPrintJobQueue.h"
 #include "WidgetPrinter/Utilities/WidgetPrinterSettings.h"
 #include "Misc/Paths.h"
 
@@ -16,7 +17,7 @@ namespace GraphPrinter
 			if (UWidgetPrinter* WidgetPrinter = IWidgetPrinterRegistry::Get().FindAvailableWidgetPrinter(Options))
 			{
 				Options = WidgetPrinter->CreateDefaultPrintOptions(UPrintWidgetOptions::EPrintScope::All, UPrintWidgetOptions::EExportMethod::Clipboard);
-				WidgetPrinter->PrintWidget(Options);
+				IPrintJobQueue::Get().Submit(Options, EPrintJobPriority::Interactive);
 			}
 		}
 	}
@@ -38,7 +39,7 @@ namespace GraphPrinter
 			if (UWidgetPrinter* WidgetPrinter = IWidgetPrinterRegistry::Get().FindAvailableWidgetPrinter(Options))
 			{
 				Options = WidgetPrinter->CreateDefaultPrintOptions(UPrintWidgetOptions::EPrintScope::Selected, UPrintWidgetOptions::EExportMethod::Clipboard);
-				WidgetPrinter->PrintWidget(Options);
+				IPrintJobQueue::Get().Submit(Options, EPrintJobPriority::Interactive);
 			}
 		}
 	}
@@ -61,7 +62,7 @@ namespace GraphPrinter
 			if (UWidgetPrinter* WidgetPrinter = IWidgetPrinterRegistry::Get().FindAvailableWidgetPrinter(Options))
 			{
 				Options = WidgetPrinter->CreateDefaultPrintOptions(UPrintWidgetOptions::EPrintScope::All, UPrintWidgetOptions::EExportMethod::ImageFile);
-				WidgetPrinter->PrintWidget(Options);
+				IPrintJobQueue::Get().Submit(Options, EPrintJobPriority::Interactive);
 			}
 		}
 	}
@@ -83,7 +84,7 @@ namespace GraphPrinter
 			if (UWidgetPrinter* WidgetPrinter = IWidgetPrinterRegistry::Get().FindAvailableWidgetPrinter(Options))
 			{
 				Options = WidgetPrinter->CreateDefaultPrintOptions(UPrintWidgetOptions::EPrintScope::Selected, UPrintWidgetOptions::EExportMethod::ImageFile);
-				WidgetPrinter->PrintWidget(Options);
+				IPrintJobQueue::Get().Submit(Options, EPrintJobPriority::Interactive);
 			}
 		}
 	}
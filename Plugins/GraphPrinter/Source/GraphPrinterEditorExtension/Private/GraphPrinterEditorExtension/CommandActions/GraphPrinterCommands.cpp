@@ -112,7 +112,8 @@ namespace GraphPrinter
 							FExecuteAction::CreateRaw(&ISupportedWidgetRegistry::Get(), &ISupportedWidgetRegistry::SetSelectedWidget, SupportedWidget.GetIdentifier()),
 							FCanExecuteAction(),
 							FIsActionChecked::CreateLambda(
-								[&SupportedWidget]() -> bool
+								// Captures a copy since the list of supported widgets may be updated while collecting them over several frames.
+								[SupportedWidget]() -> bool
 								{
 									const TOptional<FSupportedWidget>& SelectedWidget = ISupportedWidgetRegistry::Get().GetSelectedWidget();
 									return (SelectedWidget.IsSet() && (SelectedWidget.GetValue() == SupportedWidget));
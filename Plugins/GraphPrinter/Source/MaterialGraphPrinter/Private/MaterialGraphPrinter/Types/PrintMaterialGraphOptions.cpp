@@ -22,3 +22,10 @@ UPrintWidgetOptions* UPrintMaterialGraphOptions::Duplicate(const TSubclassOf<UPr
 	
 	return Destination;
 }
+
+FString UPrintMaterialGraphOptions::GetContentHashText() const
+{
+	FString Text = Super::GetContentHashText();
+	Text += FString::Printf(TEXT("MaterialGraphExportMethod=%d\n"), static_cast<int32>(MaterialGraphExportMethod));
+	return Text;
+}
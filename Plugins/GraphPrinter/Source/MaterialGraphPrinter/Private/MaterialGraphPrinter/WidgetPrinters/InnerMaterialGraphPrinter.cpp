@@ -32,6 +32,15 @@ namespace GraphPrinter
 		return false;
 	}
 
+	bool FMaterialGraphPrinter::SupportsTiledDrawing() const
+	{
+		// Since the preview viewport is combined with the render target of the graph, only the graph can be drawn in tiles.
+		return (
+			Super::SupportsTiledDrawing() &&
+			(PrintOptions->MaterialGraphExportMethod == EMaterialGraphExportMethod::GraphOnly)
+		);
+	}
+
 	UTextureRenderTarget2D* FMaterialGraphPrinter::DrawWidgetToRenderTarget()
 	{
 		UTextureRenderTarget2D* RenderedGraph = Super::DrawWidgetToRenderTarget();
@@ -52,6 +61,7 @@ namespace GraphPrinter
 		const UWidgetPrinter::FRenderingResult RenderingResult = GetRenderingResult<UViewportPrinter>(ToRenderTarget);
 		if (!RenderingResult.IsValid())
 		{
+			ReleaseRenderTargetInternal(RenderedGraph);
 			return nullptr;
 		}
 
@@ -60,7 +70,8 @@ namespace GraphPrinter
 			ExportRenderTargetToImageFileInternal(
 				RenderingResult.RenderTarget.Get(),
 				RenderingResult.Filename,
-				PrintOptions->ImageWriteOptions
+				PrintOptions->ImageWriteOptions,
+				PrintOptions->PngColorReduction
 			);
 			
 			return RenderedGraph;
@@ -109,13 +120,20 @@ namespace GraphPrinter
 			FMath::Max(RenderingResult.RenderTarget->SizeY, RenderedGraph->SizeY)
 		);
 		
-		return DrawWidgetToRenderTargetInternal(
+		UTextureRenderTarget2D* CombinedRenderTarget = DrawWidgetToRenderTargetInternal(
 			CombinedWidget,
 			CombinedSize,
 			PrintOptions->FilteringMode,
 			false, // If draws with gamma twice, it will be too bright, so gamma is not used here.
-			PrintOptions->RenderingScale
+			PrintOptions->RenderingScale,
+			ShouldUsePooledRenderTarget(),
+			!ShouldReadbackAsynchronously()
 		);
+
+		// The graph has already been drawn into the combined render target, so it can be reused in the next print.
+		ReleaseRenderTargetInternal(RenderedGraph);
+
+		return CombinedRenderTarget;
 	}
 
 	FString FMaterialGraphPrinter::GetWidgetTitle()
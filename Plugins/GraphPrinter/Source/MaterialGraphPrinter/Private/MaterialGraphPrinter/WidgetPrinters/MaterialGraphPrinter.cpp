@@ -4,6 +4,7 @@
 #include "MaterialGraphPrinter/WidgetPrinters/InnerMaterialGraphPrinter.h"
 #include "MaterialGraphPrinter/Types/PrintMaterialGraphOptions.h"
 #include "MaterialGraphPrinter/Utilities/MaterialGraphPrinterSettings.h"
+#include "WidgetPrinter/Utilities/CastSlateWidget.h"
 #include "GraphPrinterGlobals/GraphPrinterGlobals.h"
 
 #if UE_5_01_OR_LATER
@@ -32,6 +33,11 @@ TOptional<GraphPrinter::FSupportedWidget> UMaterialGraphPrinter::CheckIfSupporte
 	return GraphPrinter::FSupportedWidget(MaterialGraphEditor.ToSharedRef(), MaterialGraphTitle, GetPriority());
 }
 
+TArray<FName> UMaterialGraphPrinter::GetSupportedWidgetTypeNames() const
+{
+	return { GP_SLATE_WIDGET_TYPE_NAME(SGraphEditorImpl) };
+}
+
 UPrintWidgetOptions* UMaterialGraphPrinter::CreateDefaultPrintOptions(
 	const UPrintWidgetOptions::EPrintScope PrintScope,
 	const UPrintWidgetOptions::EExportMethod ExportMethod
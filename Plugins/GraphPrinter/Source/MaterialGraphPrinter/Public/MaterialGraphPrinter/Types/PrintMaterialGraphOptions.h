@@ -21,6 +21,7 @@ public:
 
 	// UPrintWidgetOptions interface.
 	virtual UPrintWidgetOptions* Duplicate(const TSubclassOf<UPrintWidgetOptions>& DestinationClass) const override;
+	virtual FString GetContentHashText() const override;
 	// End of UPrintWidgetOptions interface.
 
 public:
@@ -29,6 +29,7 @@ namespace GraphPrinter
 		// End of IInnerWidgetPrinter interface.
 
 		// TInnerWidgetPrinter interface.
+		virtual bool SupportsTiledDrawing() const override;
 		virtual UTextureRenderTarget2D* DrawWidgetToRenderTarget() override;
 		virtual FString GetWidgetTitle() override;
 		// End of TInnerWidgetPrinter interface.
@@ -23,6 +23,7 @@ public:
 	// UWidgetPrinter interface.
 	virtual int32 GetPriority() const override;
 	virtual TOptional<GraphPrinter::FSupportedWidget> CheckIfSupported(const TSharedRef<SWidget>& TestWidget) const override;
+	virtual TArray<FName> GetSupportedWidgetTypeNames() const override;
 	virtual UPrintWidgetOptions* CreateDefaultPrintOptions(
 		const UPrintWidgetOptions::EPrintScope PrintScope,
 		const UPrintWidgetOptions::EExportMethod ExportMethod
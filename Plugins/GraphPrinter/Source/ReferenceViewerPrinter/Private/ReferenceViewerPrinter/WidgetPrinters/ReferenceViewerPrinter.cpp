@@ -2,6 +2,7 @@
 
 #include "ReferenceViewerPrinter/WidgetPrinters/ReferenceViewerPrinter.h"
 #include "ReferenceViewerPrinter/WidgetPrinters/InnerReferenceViewerPrinter.h"
+#include "WidgetPrinter/Utilities/CastSlateWidget.h"
 #include "GraphPrinterGlobals/GraphPrinterGlobals.h"
 
 #if UE_5_01_OR_LATER
@@ -30,6 +31,11 @@ TOptional<GraphPrinter::FSupportedWidget> UReferenceViewerPrinter::CheckIfSuppor
 	return GraphPrinter::FSupportedWidget(ReferenceViewerGraphEditor.ToSharedRef(), ReferenceViewerGraphTitle, GetPriority());
 }
 
+TArray<FName> UReferenceViewerPrinter::GetSupportedWidgetTypeNames() const
+{
+	return { GP_SLATE_WIDGET_TYPE_NAME(SGraphEditorImpl) };
+}
+
 TSharedRef<GraphPrinter::IInnerWidgetPrinter> UReferenceViewerPrinter::CreatePrintModeInnerPrinter(const FSimpleDelegate& OnPrinterProcessingFinished) const
 {
 	return MakeShared<GraphPrinter::FReferenceViewerPrinter>(
@@ -3,467 +3,694 @@
 #include "TextChunkHelper/Png/PngTextChunk.h"
 #include "GraphPrinterGlobals/GraphPrinterGlobals.h"
 #include "Misc/FileHelper.h"
-#include "Misc/ScopeLock.h"
 #include "Misc/Paths.h"
 
 #if WITH_UNREALPNG
 
 THIRD_PARTY_INCLUDES_START
-
-#if !WITH_LIBPNG_1_6
-#include "ThirdParty/libPNG/libPNG-1.5.2/pnginfo.h"
-#endif
-
-#include <setjmp.h>
+#include "zlib.h"
 THIRD_PARTY_INCLUDES_END
 
-// Disables warning "interaction between '_setjmp' and C++ object destruction is non-portable".
-#ifdef _MSC_VER
-#pragma warning(push)
-#pragma warning(disable:4611)
-#endif
-
 namespace TextChunkHelper
 {
 	namespace PngTextChunkInternal
 	{
-		/**
-		 * Classes for safely handling pointers used by libpng.
-		 */
-		class FPngReadGuard : public FNoncopyable
+		// Checks if either the key or value is empty and if the key and value string contains \0.
+		bool ValidateMap(const TMap<FString, FString>& Map)
 		{
-		public:
-			// Constructor.
-			FPngReadGuard(
-				png_voidp Context,
-				png_error_ptr ErrorCallback,
-				png_error_ptr WarningCallback,
-				png_malloc_ptr MallocCallback,
-				png_free_ptr FreeCallback,
-				png_rw_ptr ReadDataCallback
-			) 
-			{
-				ReadPtr = png_create_read_struct_2(
-					PNG_LIBPNG_VER_STRING,
-					Context,
-					ErrorCallback,
-					WarningCallback,
-					nullptr,
-					MallocCallback,
-					FreeCallback
-				);
-				InfoPtr = png_create_info_struct(ReadPtr);
-				png_set_read_fn(ReadPtr, Context, ReadDataCallback);
-			}
+			auto HasEscapeSequence = [](const FString& String) -> bool
+			{
+				for (const auto& Char : String)
+				{
+					if (Char == TEXT('\0'))
+					{
+						return true;
+					}
+				}
+
+				return false;
+			};
+
+			bool bIsValid = true;
 
-			// Destructor.
-			~FPngReadGuard()
+			for (const auto& Pair : Map)
 			{
-				png_destroy_read_struct(&ReadPtr, &InfoPtr, nullptr);
+				if (Pair.Key.IsEmpty() || 
+					Pair.Value.IsEmpty() ||
+					HasEscapeSequence(Pair.Key) || 
+					HasEscapeSequence(Pair.Value)
+				)
+				{
+					bIsValid = false;
+					break;
+				}
 			}
 
-			// Accessor and validation.
-			png_structp GetReadPtr() const { return ReadPtr; }
-			png_infop GetInfoPtr() const { return InfoPtr; }
-			bool IsValid() const { return (ReadPtr != nullptr && InfoPtr != nullptr); }
+			return bIsValid;
+		}
 
-		private:
-			// Pointers used to access png files with libpng.
-			png_structp ReadPtr;
-			png_infop InfoPtr;
-		};
+		// The length of the signature at the beginning of the png file.
+		static constexpr int32 PngFileSignatureLength = 8;
+
+		// The maximum length of the keyword of the text chunk defined in the png specification.
+		static constexpr int32 MaxKeywordLength = 79;
 
-		class FPngWriteGuard : public FNoncopyable
+		// The only compression method defined in the png specification (zlib deflate).
+		static constexpr uint8 CompressionMethodDeflate = 0;
+
+		// The maximum size of the decompressed text of a zTXt or iTXt chunk.
+		// It is far larger than the widget information of any graph, and prevents a crafted png file from exhausting the memory.
+		static constexpr int32 MaxUncompressedTextSize = 64 * 1024 * 1024;
+
+		// Define the types of chunks in the png file.
+		static const ANSICHAR* TextChunkType = "tEXt";
+		static const ANSICHAR* CompressedTextChunkType = "zTXt";
+		static const ANSICHAR* InternationalTextChunkType = "iTXt";
+		static const ANSICHAR* ImageDataChunkType = "IDAT";
+		static const ANSICHAR* ImageEndChunkType = "IEND";
+
+		// Reads a 4-byte big-endian integer.
+		uint32 ReadUInt32(const uint8* Data)
+		{
+			return (
+				(static_cast<uint32>(Data[0]) << 24) |
+				(static_cast<uint32>(Data[1]) << 16) |
+				(static_cast<uint32>(Data[2]) << 8) |
+				static_cast<uint32>(Data[3])
+			);
+		}
+
+		// Writes a 4-byte big-endian integer.
+		void AppendUInt32(TArray<uint8>& Destination, const uint32 Value)
+		{
+			const uint8 Bytes[4] = {
+				static_cast<uint8>((Value >> 24) & 0xFF),
+				static_cast<uint8>((Value >> 16) & 0xFF),
+				static_cast<uint8>((Value >> 8) & 0xFF),
+				static_cast<uint8>(Value & 0xFF),
+			};
+			Destination.Append(Bytes, 4);
+		}
+
+		// Returns whether the 4 bytes of the chunk type match the specified type.
+		bool IsChunkType(const uint8* ChunkType, const ANSICHAR* Type)
 		{
+			return (FMemory::Memcmp(ChunkType, Type, 4) == 0);
+		}
+
+		// Returns whether the 4 bytes of the chunk type is one of the chunk types that store text.
+		bool IsTextChunkType(const uint8* ChunkType)
+		{
+			return (
+				IsChunkType(ChunkType, TextChunkType) ||
+				IsChunkType(ChunkType, CompressedTextChunkType) ||
+				IsChunkType(ChunkType, InternationalTextChunkType)
+			);
+		}
+
+		/**
+		 * A struct that represents the position of a chunk in the png file.
+		 */
+		struct FPngChunk
+		{
+		public:
+			// The position of the beginning of the chunk, including the length field.
+			int64 Offset;
+
+			// The length of the chunk data.
+			uint32 DataLength;
+
 		public:
-			// Constructor.
-			FPngWriteGuard(
-				png_voidp Context,
-				png_error_ptr ErrorCallback,
-				png_error_ptr WarningCallback,
-				png_rw_ptr WriteDataCallback,
-				png_flush_ptr OutputFlushCallback
-			)
+			// Returns the position of the chunk type.
+			int64 GetTypeOffset() const { return Offset + 4; }
+
+			// Returns the position of the chunk data.
+			int64 GetDataOffset() const { return Offset + 8; }
+
+			// Returns the size of the entire chunk including the length, type and CRC fields.
+			int64 GetTotalSize() const { return static_cast<int64>(DataLength) + 12; }
+
+			// Returns whether the chunk is of the specified type.
+			bool IsType(const TArray<uint8>& CompressedData, const ANSICHAR* Type) const
 			{
-				WritePtr = png_create_write_struct(PNG_LIBPNG_VER_STRING, Context, ErrorCallback, WarningCallback);
-				InfoPtr = png_create_info_struct(WritePtr);
-				png_set_write_fn(WritePtr, Context, WriteDataCallback, OutputFlushCallback);
+				return IsChunkType(&CompressedData[GetTypeOffset()], Type);
 			}
 
-			// Destructor.
-			~FPngWriteGuard()
+			// Returns whether the chunk is one of the chunk types that store text.
+			bool IsTextChunk(const TArray<uint8>& CompressedData) const
 			{
-				png_destroy_write_struct(&WritePtr, &InfoPtr);
+				return IsTextChunkType(&CompressedData[GetTypeOffset()]);
 			}
 
-			// Accessor and validation.
-			png_structp GetWritePtr() const { return WritePtr; }
-			png_infop GetInfoPtr() const { return InfoPtr; }
-			bool IsValid() const { return (WritePtr != nullptr && InfoPtr != nullptr); }
-
-		private:
-			// Pointers used to access png files with libpng.
-			png_structp WritePtr;
-			png_infop InfoPtr;
+			// Returns whether the CRC stored in the chunk matches the chunk type and data.
+			bool IsCrcValid(const TArray<uint8>& CompressedData) const
+			{
+				const uLong Crc = crc32(
+					crc32(0L, Z_NULL, 0),
+					&CompressedData[GetTypeOffset()],
+					DataLength + 4
+				);
+				return (static_cast<uint32>(Crc) == ReadUInt32(&CompressedData[GetDataOffset() + DataLength]));
+			}
 		};
 
-		// Copies compression levels, IHDR chunks, row pointers, channels.
-		void CopyPngInfoStruct(
-			png_structp DestinationPngPtr,
-			png_infop DestinationInfoPtr,
-			png_structp SourcePngPtr,
-			png_infop SourceInfoPtr
-		)
+		// Lists the positions of all chunks in the png file without decoding them.
+		bool ParseChunks(const TArray<uint8>& CompressedData, TArray<FPngChunk>& OutChunks)
 		{
-			check(DestinationPngPtr != nullptr && DestinationInfoPtr != nullptr);
-			check(SourcePngPtr != nullptr && SourceInfoPtr != nullptr);
+			int64 Offset = PngFileSignatureLength;
+			while (Offset + 12 <= CompressedData.Num())
+			{
+				FPngChunk Chunk;
+				Chunk.Offset = Offset;
+				Chunk.DataLength = ReadUInt32(&CompressedData[Offset]);
+				if (Offset + Chunk.GetTotalSize() > CompressedData.Num())
+				{
+					return false;
+				}
+
+				OutChunks.Add(Chunk);
+				if (Chunk.IsType(CompressedData, ImageEndChunkType))
+				{
+					return true;
+				}
+
+				Offset += Chunk.GetTotalSize();
+			}
+
+			return false;
+		}
 
-			// Set compression level.
+		// Returns the position of the first \0 in the data.
+		// If not found, INDEX_NONE is returned.
+		int32 FindNullTerminator(const uint8* Data, const int64 Length)
+		{
+			if (Length <= 0)
 			{
-				png_set_compression_level(DestinationPngPtr, 1);
+				return INDEX_NONE;
 			}
-			// Copy IHDR.
+			
+			const void* Terminator = FMemory::Memchr(Data, '\0', Length);
+			if (Terminator == nullptr)
 			{
-				png_uint_32 Width;
-				png_uint_32 Height;
-				int32 BitDepth;
-				int32 ColorType;
-				int32 InterlaceMethod;
-				int32 CompressionMethod;
-				int32 FilterMethod;
-				png_get_IHDR(SourcePngPtr, SourceInfoPtr, &Width, &Height, &BitDepth, &ColorType, &InterlaceMethod, &CompressionMethod, &FilterMethod);
-				png_set_IHDR(DestinationPngPtr, DestinationInfoPtr, Width, Height, BitDepth, ColorType, InterlaceMethod, CompressionMethod, FilterMethod);
+				return INDEX_NONE;
 			}
-			// Copy row pointers.
+			return static_cast<int32>(static_cast<const uint8*>(Terminator) - Data);
+		}
+
+		// Returns the keyword of the text chunk.
+		TArray<uint8> GetTextChunkKeyword(const TArray<uint8>& CompressedData, const FPngChunk& Chunk)
+		{
+			TArray<uint8> Keyword;
+			const int32 KeywordLength = FindNullTerminator(&CompressedData[Chunk.GetDataOffset()], Chunk.DataLength);
+			if (KeywordLength != INDEX_NONE)
 			{
-				const png_bytepp RowPointers = png_get_rows(SourcePngPtr, SourceInfoPtr);
-				png_set_rows(DestinationPngPtr, DestinationInfoPtr, RowPointers);
+				Keyword.Append(&CompressedData[Chunk.GetDataOffset()], KeywordLength);
 			}
-			// Copy channels.
+			return Keyword;
+		}
+
+		// Compresses the bytes with zlib as defined in the png specification.
+		bool CompressBytes(const TArray<uint8>& Source, TArray<uint8>& OutCompressed)
+		{
+			uLongf CompressedSize = compressBound(Source.Num());
+			OutCompressed.SetNumUninitialized(static_cast<int32>(CompressedSize));
+			if (compress2(OutCompressed.GetData(), &CompressedSize, Source.GetData(), Source.Num(), Z_DEFAULT_COMPRESSION) != Z_OK)
 			{
-				DestinationInfoPtr->channels = SourceInfoPtr->channels;
+				return false;
 			}
+
+			OutCompressed.SetNum(static_cast<int32>(CompressedSize));
+			return true;
 		}
 
-		// Checks if either the key or value is empty and if the key and value string contains \0.
-		bool ValidateMap(const TMap<FString, FString>& Map)
+		// Decompresses the zlib stream whose uncompressed size is not known in advance.
+		// Fails if the uncompressed size exceeds MaxUncompressedTextSize.
+		bool UncompressBytes(const uint8* Source, const int64 SourceLength, TArray<uint8>& OutUncompressed)
 		{
-			auto HasEscapeSequence = [](const FString& String) -> bool
+			z_stream Stream;
+			FMemory::Memzero(Stream);
+			if (inflateInit(&Stream) != Z_OK)
 			{
-				for (const auto& Char : String)
+				return false;
+			}
+
+			// Repetitive text usually compresses well, so starts with a buffer larger than the source.
+			OutUncompressed.SetNumUninitialized(static_cast<int32>(FMath::Clamp<int64>(SourceLength * 4, 1024, MaxUncompressedTextSize)));
+			Stream.next_in = const_cast<Bytef*>(Source);
+			Stream.avail_in = static_cast<uInt>(SourceLength);
+
+			int32 Result = Z_OK;
+			while (Result == Z_OK)
+			{
+				if (Stream.total_out >= static_cast<uLong>(OutUncompressed.Num()))
 				{
-					if (Char == TEXT('\0'))
+					if (OutUncompressed.Num() >= MaxUncompressedTextSize)
 					{
-						return true;
+						UE_LOG(LogGraphPrinter, Error, TEXT("The text chunk is larger than %d bytes when decompressed."), MaxUncompressedTextSize);
+						break;
 					}
+					OutUncompressed.SetNumUninitialized(FMath::Min(OutUncompressed.Num() * 2, MaxUncompressedTextSize));
 				}
 
+				Stream.next_out = OutUncompressed.GetData() + Stream.total_out;
+				Stream.avail_out = static_cast<uInt>(OutUncompressed.Num() - Stream.total_out);
+				Result = inflate(&Stream, Z_NO_FLUSH);
+			}
+
+			const uLong UncompressedSize = Stream.total_out;
+			inflateEnd(&Stream);
+			if (Result != Z_STREAM_END)
+			{
 				return false;
-			};
+			}
 
-			bool bIsValid = true;
+			OutUncompressed.SetNum(static_cast<int32>(UncompressedSize));
+			return true;
+		}
 
-			for (const auto& Pair : Map)
+		// Converts a string to the Latin-1 bytes that tEXt and zTXt chunks and the keywords of all text chunks require.
+		// Returns false if the string contains characters that cannot be represented in Latin-1.
+		bool ConvertStringToLatin1ByteArray(const FString& String, TArray<uint8>& OutByteArray)
+		{
+			OutByteArray.Reset(String.Len());
+			for (const TCHAR Char : String)
 			{
-				if (Pair.Key.IsEmpty() || 
-					Pair.Value.IsEmpty() ||
-					HasEscapeSequence(Pair.Key) || 
-					HasEscapeSequence(Pair.Value)
-				)
+				if (static_cast<uint32>(Char) > 0xFF)
 				{
-					bIsValid = false;
-					break;
+					return false;
 				}
+				OutByteArray.Add(static_cast<uint8>(Char));
 			}
+			return true;
+		}
 
-			return bIsValid;
+		// Converts a string to UTF-8 bytes.
+		TArray<uint8> ConvertStringToUtf8ByteArray(const FString& String)
+		{
+			const FTCHARToUTF8 Converted(*String);
+			TArray<uint8> ByteArray;
+			ByteArray.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+			return ByteArray;
 		}
 
-		// Converts a string in the state of TArray<uint8> to FString.
-		FString ConvertByteArrayToString(const TArray<uint8>& ByteArray)
+		// Converts Latin-1 bytes in the text chunk to FString at once.
+		FString ConvertBytesToString(const uint8* Bytes, const int32 Length)
 		{
-			FString ConvertedString = TEXT("");
-			for (const auto& Byte : ByteArray)
+			FString ConvertedString;
+			if (Length <= 0)
 			{
-				ConvertedString += FString::Printf(TEXT("%c"), Byte);
+				return ConvertedString;
 			}
+
+			TArray<TCHAR>& CharArray = ConvertedString.GetCharArray();
+			CharArray.SetNumUninitialized(Length + 1);
+			for (int32 Index = 0; Index < Length; Index++)
+			{
+				CharArray[Index] = static_cast<TCHAR>(Bytes[Index]);
+			}
+			CharArray[Length] = TEXT('\0');
 			return ConvertedString;
 		}
 
-		// Define the name of the text chunk in the png file.
-		static const FString TextChunkName = TEXT("tEXt");
+		// Converts UTF-8 bytes in the text chunk to FString at once.
+		FString ConvertUtf8BytesToString(const uint8* Bytes, const int32 Length)
+		{
+			if (Length <= 0)
+			{
+				return FString();
+			}
+			
+			const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Bytes), Length);
+			return FString(Converted.Length(), Converted.Get());
+		}
 
-		// Gets the position of the next text chunk closest to the StartPosition.
-		// If not found, INDEX_NONE is returned.
-		int32 GetTextChunkPosition(const TArray<uint8>& CompressedData, int32 StartPosition = 0)
+		/**
+		 * A struct that holds a text chunk waiting to be written.
+		 */
+		struct FTextChunkToWrite
+		{
+		public:
+			// The type of the chunk.
+			const ANSICHAR* Type;
+
+			// The keyword used to replace existing text chunks.
+			TArray<uint8> Keyword;
+
+			// The data of the chunk, starting with the keyword.
+			TArray<uint8> Data;
+		};
+
+		// Appends the text to the data of the iTXt chunk that starts with the keyword and \0.
+		bool AppendInternationalText(const FString& Text, const bool bCompress, FTextChunkToWrite& OutTextChunk)
+		{
+			// Keyword, \0, compression flag, compression method, language tag, \0, translated keyword, \0, UTF-8 text.
+			TArray<uint8> Utf8Text = ConvertStringToUtf8ByteArray(Text);
+			if (bCompress)
+			{
+				TArray<uint8> CompressedText;
+				if (!CompressBytes(Utf8Text, CompressedText))
+				{
+					return false;
+				}
+				Utf8Text = MoveTemp(CompressedText);
+			}
+
+			OutTextChunk.Type = InternationalTextChunkType;
+			OutTextChunk.Data.Add(bCompress ? 1 : 0);
+			OutTextChunk.Data.Add(CompressionMethodDeflate);
+			OutTextChunk.Data.Add('\0');
+			OutTextChunk.Data.Add('\0');
+			OutTextChunk.Data.Append(Utf8Text);
+			return true;
+		}
+
+		// Creates the data of the text chunk in the specified format.
+		// The text that cannot be represented in Latin-1 is stored as UTF-8 in an iTXt chunk with the same compression instead.
+		bool MakeTextChunk(const TArray<uint8>& Keyword, const FString& Text, const ETextChunkFormat Format, FTextChunkToWrite& OutTextChunk)
 		{
-			int32 FoundPosition = INDEX_NONE;
-			const int32 ChunkNameLength = TextChunkName.Len();
-			for (int32 Index = StartPosition; Index < CompressedData.Num() - ChunkNameLength; Index++)
+			OutTextChunk.Keyword = Keyword;
+			OutTextChunk.Data = Keyword;
+			OutTextChunk.Data.Add('\0');
+
+			TArray<uint8> Latin1Text;
+			const bool bIsLatin1 = ConvertStringToLatin1ByteArray(Text, Latin1Text);
+
+			switch (Format)
 			{
-				bool bIsMatch = true;
-				for (int32 Offset = 0; Offset < ChunkNameLength; Offset++)
+			case ETextChunkFormat::Uncompressed:
 				{
-					if (CompressedData[Index + Offset] != TextChunkName[Offset])
+					if (!bIsLatin1)
 					{
-						bIsMatch = false;
+						return AppendInternationalText(Text, false, OutTextChunk);
 					}
+
+					// Keyword, \0, Latin-1 text.
+					OutTextChunk.Type = TextChunkType;
+					OutTextChunk.Data.Append(Latin1Text);
+					return true;
 				}
+			case ETextChunkFormat::Compressed:
+				{
+					if (!bIsLatin1)
+					{
+						return AppendInternationalText(Text, true, OutTextChunk);
+					}
 
-				if (bIsMatch)
+					// Keyword, \0, compression method, compressed Latin-1 text.
+					TArray<uint8> CompressedText;
+					if (!CompressBytes(Latin1Text, CompressedText))
+					{
+						return false;
+					}
+					
+					OutTextChunk.Type = CompressedTextChunkType;
+					OutTextChunk.Data.Add(CompressionMethodDeflate);
+					OutTextChunk.Data.Append(CompressedText);
+					return true;
+				}
+			case ETextChunkFormat::CompressedUnicode:
 				{
-					FoundPosition = Index + ChunkNameLength;
-					break;
+					return AppendInternationalText(Text, true, OutTextChunk);
 				}
+			default:
+				break;
 			}
 
-			return FoundPosition;
+			return false;
 		}
 
-		// Only allow one thread to use libpng at a time.
-		static FCriticalSection PngTextChunkHelperSection;
+		// Converts the map to the text chunks in the specified format.
+		bool MakeTextChunks(
+			const TMap<FString, FString>& MapToWrite,
+			const ETextChunkFormat Format,
+			TArray<FTextChunkToWrite>& OutTextChunks,
+			int64& OutTotalTextChunkSize
+		)
+		{
+			// Determines if the map is useable.
+			if (!ValidateMap(MapToWrite))
+			{
+				UE_LOG(LogGraphPrinter, Warning, TEXT("Writing to a text chunk is not possible because either the key or value is empty, or the key and value string contains \0."));
+				return false;
+			}
 
-		// Determine if this file is in Png format from the Png signature size.
-		static constexpr int32 PngSignatureSize = sizeof(png_size_t);
-	}
+			OutTotalTextChunkSize = 0;
+			for (const auto& Pair : MapToWrite)
+			{
+				TArray<uint8> Keyword;
+				if (!ConvertStringToLatin1ByteArray(Pair.Key, Keyword))
+				{
+					UE_LOG(LogGraphPrinter, Warning, TEXT("The key of the text chunk must consist of Latin-1 characters : %s"), *Pair.Key);
+					return false;
+				}
+				if (Keyword.Num() == 0 || Keyword.Num() > MaxKeywordLength)
+				{
+					UE_LOG(LogGraphPrinter, Warning, TEXT("The key of the text chunk must be between 1 and %d characters : %s"), MaxKeywordLength, *Pair.Key);
+					return false;
+				}
 
-	FPngTextChunk::FPngTextChunk()
-		: Filename(TEXT(""))
-		, ReadOffset(0)
-	{
-	}
+				FTextChunkToWrite TextChunkToWrite;
+				if (!MakeTextChunk(Keyword, Pair.Value, Format, TextChunkToWrite))
+				{
+					UE_LOG(LogGraphPrinter, Error, TEXT("Failed to compress the text of the text chunk : %s"), *Pair.Key);
+					return false;
+				}
 
-	bool FPngTextChunk::Write(const TMap<FString, FString>& MapToWrite)
-	{
-		check(IsPng());
+				OutTotalTextChunkSize += TextChunkToWrite.Data.Num() + 12;
+				OutTextChunks.Add(MoveTemp(TextChunkToWrite));
+			}
 
-		// Determines if the map is useable.
-		if (!PngTextChunkInternal::ValidateMap(MapToWrite))
-		{
-			UE_LOG(LogGraphPrinter, Warning, TEXT("Writing to a text chunk is not possible because either the key or value is empty, or the key and value string contains \0."));
-			return false;
+			return true;
 		}
 
-		// Only allow one thread to use libpng at a time.
-		FScopeLock PngLock(&PngTextChunkInternal::PngTextChunkHelperSection);
-	
-		// Resets to the beginning of file so we can use png_read_png(), which expects to start at the beginning.
-		ReadOffset = 0;
-
-		// Reads the png_info of the original image file.
-		const PngTextChunkInternal::FPngReadGuard ReadGuard(
-			this,
-			FPngTextChunk::UserError,
-			FPngTextChunk::UserWarning,
-			FPngTextChunk::UserMalloc,
-			FPngTextChunk::UserFree,
-			FPngTextChunk::UserReadCompressed
-		);
-		if (!ReadGuard.IsValid())
+		// Appends a chunk consisting of the type and the data to the png file.
+		void AppendChunk(TArray<uint8>& Destination, const ANSICHAR* Type, const TArray<uint8>& Data)
 		{
-			return false;
+			AppendUInt32(Destination, Data.Num());
+
+			// The CRC is calculated from the chunk type and the chunk data.
+			const int32 CrcStartPosition = Destination.Num();
+			Destination.Append(reinterpret_cast<const uint8*>(Type), 4);
+			Destination.Append(Data);
+
+			const uLong Crc = crc32(
+				crc32(0L, Z_NULL, 0),
+				&Destination[CrcStartPosition],
+				Destination.Num() - CrcStartPosition
+			);
+			AppendUInt32(Destination, static_cast<uint32>(Crc));
 		}
 
-		if (setjmp(png_jmpbuf(ReadGuard.GetReadPtr())) != 0)
+		// Decodes the keyword and the text of any of the tEXt, zTXt and iTXt chunks.
+		bool DecodeTextChunk(const TArray<uint8>& CompressedData, const FPngChunk& Chunk, FString& OutKey, FString& OutText)
 		{
-			return false;
-		}
+			const uint8* Data = &CompressedData[Chunk.GetDataOffset()];
+			const int64 DataLength = Chunk.DataLength;
+			
+			const int32 KeywordLength = FindNullTerminator(Data, DataLength);
+			if (KeywordLength == INDEX_NONE)
+			{
+				return false;
+			}
+			OutKey = ConvertBytesToString(Data, KeywordLength);
 
-		png_read_png(ReadGuard.GetReadPtr(), ReadGuard.GetInfoPtr(), PNG_TRANSFORM_IDENTITY, nullptr);
+			const uint8* Rest = Data + KeywordLength + 1;
+			int64 RestLength = DataLength - KeywordLength - 1;
+			
+			if (Chunk.IsType(CompressedData, TextChunkType))
+			{
+				OutText = ConvertBytesToString(Rest, static_cast<int32>(RestLength));
+				return true;
+			}
 
-		// Prepares png_struct etc. for writing.
-		const PngTextChunkInternal::FPngWriteGuard WriteGuard(
-			this,
-			FPngTextChunk::UserError,
-			FPngTextChunk::UserWarning,
-			FPngTextChunk::UserWriteCompressed,
-			FPngTextChunk::UserFlushData
-		);
-		if (!WriteGuard.IsValid())
-		{
-			return false;
-		}
+			if (Chunk.IsType(CompressedData, CompressedTextChunkType))
+			{
+				if (RestLength < 1 || Rest[0] != CompressionMethodDeflate)
+				{
+					return false;
+				}
 
-		if (setjmp(png_jmpbuf(WriteGuard.GetWritePtr())) != 0)
-		{
-			return false;
-		}
+				TArray<uint8> UncompressedText;
+				if (!UncompressBytes(Rest + 1, RestLength - 1, UncompressedText))
+				{
+					return false;
+				}
 
-		// Copies the read original png_info to png_info used for write.
-		PngTextChunkInternal::CopyPngInfoStruct(
-			WriteGuard.GetWritePtr(), WriteGuard.GetInfoPtr(),
-			ReadGuard.GetReadPtr(), ReadGuard.GetInfoPtr()
-		);
-	
-		// Creates text chunk data and set it to png.
-		// When converting from FString to png_charp, most of the time the escape sequences are mixed first.
-		const int32 NumText = MapToWrite.Num();
-		TArray<png_text> TextPtr;
-		TextPtr.Reserve(NumText);
-		for (const auto& Data : MapToWrite)
-		{
-			png_text Text;
-			FMemory::Memzero(Text);
-
-			auto Key = StringCast<ANSICHAR>(*Data.Key);
-			const int32 KeyLength = TCString<ANSICHAR>::Strlen(Key.Get());
-			if (KeyLength > 0)
-			{
-#if UE_5_06_OR_LATER
-				auto* const KeyBuffer = static_cast<ANSICHAR*>(FMemory::Malloc(KeyLength + 1));
-				TCString<ANSICHAR>::Strncpy(KeyBuffer, Key.Get(), KeyLength + 1);
-#else
-				auto* const KeyBuffer = static_cast<ANSICHAR*>(FMemory::Malloc(KeyLength));
-				TCString<ANSICHAR>::Strcpy(KeyBuffer, KeyLength, Key.Get());
-#endif
-				Text.key = KeyBuffer;
-			}
-		
-			auto Value = StringCast<ANSICHAR>(*Data.Value);
-			const int32 ValueLength = TCString<ANSICHAR>::Strlen(Value.Get());
-			if (ValueLength > 0)
-			{
-#if UE_5_06_OR_LATER
-				auto* const ValueBuffer = static_cast<ANSICHAR*>(FMemory::Malloc(ValueLength + 1));
-				TCString<ANSICHAR>::Strncpy(ValueBuffer, Value.Get(), ValueLength + 1);
-#else
-				auto* const ValueBuffer = static_cast<ANSICHAR*>(FMemory::Malloc(ValueLength));
-				TCString<ANSICHAR>::Strcpy(ValueBuffer, ValueLength, Value.Get());
-#endif
-				Text.text = ValueBuffer;
+				OutText = ConvertBytesToString(UncompressedText.GetData(), UncompressedText.Num());
+				return true;
 			}
+			
+			if (Chunk.IsType(CompressedData, InternationalTextChunkType))
+			{
+				if (RestLength < 2)
+				{
+					return false;
+				}
 
-			Text.text_length = ValueLength;
-			Text.itxt_length = 0;
-			Text.compression = PNG_TEXT_COMPRESSION_NONE;
+				const bool bIsCompressed = (Rest[0] != 0);
+				if (bIsCompressed && Rest[1] != CompressionMethodDeflate)
+				{
+					return false;
+				}
+				Rest += 2;
+				RestLength -= 2;
 
-			TextPtr.Add(Text);
-		}
-		png_set_text(WriteGuard.GetWritePtr(), WriteGuard.GetInfoPtr(), TextPtr.GetData(), NumText);
+				// Skips the language tag and the translated keyword.
+				for (int32 Count = 0; Count < 2; Count++)
+				{
+					const int32 Length = FindNullTerminator(Rest, RestLength);
+					if (Length == INDEX_NONE)
+					{
+						return false;
+					}
+					Rest += Length + 1;
+					RestLength -= Length + 1;
+				}
 
-		// Writes the data prepared so far to the png file.
-		CompressedData.Empty();
-		png_write_png(WriteGuard.GetWritePtr(), WriteGuard.GetInfoPtr(), PNG_TRANSFORM_IDENTITY, nullptr);
+				if (!bIsCompressed)
+				{
+					OutText = ConvertUtf8BytesToString(Rest, static_cast<int32>(RestLength));
+					return true;
+				}
 
-		return FFileHelper::SaveArrayToFile(CompressedData, *Filename);
+				TArray<uint8> UncompressedText;
+				if (!UncompressBytes(Rest, RestLength, UncompressedText))
+				{
+					return false;
+				}
+
+				OutText = ConvertUtf8BytesToString(UncompressedText.GetData(), UncompressedText.Num());
+				return true;
+			}
+
+			return false;
+		}
 	}
 
-	bool FPngTextChunk::Read(TMap<FString, FString>& MapToRead)
+	FPngTextChunk::FPngTextChunk()
+		: Filename(TEXT(""))
+		, bIsReadOnly(false)
 	{
-		check(IsPng());
-
-		// Only allow one thread to use libpng at a time.
-		FScopeLock PngLock(&PngTextChunkInternal::PngTextChunkHelperSection);
+	}
 
-		// Resets to the beginning of file so we can use png_read_png(), which expects to start at the beginning.
-		ReadOffset = 0;
+	bool FPngTextChunk::Write(const TMap<FString, FString>& MapToWrite, const ETextChunkFormat Format)
+	{
+		check(IsPng());
 
-		// Reads png_info.
-		const PngTextChunkInternal::FPngReadGuard ReadGuard(
-			this, 
-			FPngTextChunk::UserError, 
-			FPngTextChunk::UserWarning, 
-			FPngTextChunk::UserMalloc, 
-			FPngTextChunk::UserFree,
-			FPngTextChunk::UserReadCompressed
-		);
-		if (!ReadGuard.IsValid())
+		if (bIsReadOnly)
 		{
+			UE_LOG(LogGraphPrinter, Error, TEXT("The png file opened in read-only mode cannot be written : %s"), *Filename);
 			return false;
 		}
 
-		if (setjmp(png_jmpbuf(ReadGuard.GetReadPtr())) != 0)
+		// Lists the existing chunks so that the image data can be copied as it is without decoding.
+		TArray<PngTextChunkInternal::FPngChunk> Chunks;
+		if (!PngTextChunkInternal::ParseChunks(CompressedData, Chunks))
 		{
+			UE_LOG(LogGraphPrinter, Error, TEXT("The chunks of the png file could not be read correctly."));
 			return false;
 		}
 
-		png_read_info(ReadGuard.GetReadPtr(), ReadGuard.GetInfoPtr());
-
-		// Transfers the text chunk data to the argument map.
-		/**
-		 * png_textp TextPtr;
-		 * int32 NumText;
-		 * if (!png_get_text(ReadGuard.GetReadPtr(), ReadGuard.GetInfoPtr(), &TextPtr, &NumText))
-		 * {
-		 *     return false;
-		 * }
-		 *
-		 * for (int32 Index = 0; Index < NumText; Index++)
-		 * {
-		 *     const auto Key = FString(ANSI_TO_TCHAR(TextPtr[Index].key));
-		 *     const auto Value = FString(ANSI_TO_TCHAR(TextPtr[Index].text));
-		 *     MapToRead.Add(Key, Value);
-		 * }
-		 */
-		// Hopefully wanted to do it the above way, but using png_get_text results in a zero-terminated C string, 
-		// so if an escape sequence is mixed in during writing, the data will be lost.
-		// Therefore, the data in the text chuck is taken out in the following roundabout way.
-
-		// Finds out the number of texts.
-		png_textp UnusedTextPtr;
-		int32 NumText;
-		if (!png_get_text(ReadGuard.GetReadPtr(), ReadGuard.GetInfoPtr(), &UnusedTextPtr, &NumText))
+		// Converts the map to the text chunks in the specified format.
+		TArray<PngTextChunkInternal::FTextChunkToWrite> TextChunksToWrite;
+		int64 TotalTextChunkSize = 0;
+		if (!PngTextChunkInternal::MakeTextChunks(MapToWrite, Format, TextChunksToWrite, TotalTextChunkSize))
 		{
 			return false;
 		}
 
-		// Since there are as many text chunks as there are NumText, splits the data by \0 by the amount of NumText.
-		TArray<TArray<uint8>> SplitTextChunks;
-		int32 SearchStartPosition = 0;
-		for (int32 Count = 0; Count < NumText; Count++)
+		// Copies the chunks other than the text chunks to be replaced as they are,
+		// and inserts the new text chunks before the image data so that they can be read without reading the image data.
+		TArray<uint8> NewCompressedData;
+		NewCompressedData.Reserve(CompressedData.Num() + TotalTextChunkSize);
+		NewCompressedData.Append(CompressedData.GetData(), PngTextChunkInternal::PngFileSignatureLength);
+
+		bool bIsTextChunkInserted = false;
+		for (const auto& Chunk : Chunks)
 		{
-			const int32 TextChunkStartPosition = PngTextChunkInternal::GetTextChunkPosition(CompressedData, SearchStartPosition);
-			if (TextChunkStartPosition == INDEX_NONE)
+			if (!bIsTextChunkInserted &&
+				(Chunk.IsType(CompressedData, PngTextChunkInternal::ImageDataChunkType) || Chunk.IsType(CompressedData, PngTextChunkInternal::ImageEndChunkType)))
 			{
-				break;
+				for (const auto& TextChunkToWrite : TextChunksToWrite)
+				{
+					PngTextChunkInternal::AppendChunk(NewCompressedData, TextChunkToWrite.Type, TextChunkToWrite.Data);
+				}
+				bIsTextChunkInserted = true;
 			}
 
-			int32 SectionStart = TextChunkStartPosition;
-			int32 SectionEnd = TextChunkStartPosition;
-			for (int32 Index = TextChunkStartPosition; Index < CompressedData.Num(); Index++)
+			// Text chunks with the same keyword are replaced regardless of their format.
+			if (Chunk.IsTextChunk(CompressedData))
 			{
-				if (CompressedData[Index] == TEXT('\0'))
-				{
-					SectionEnd = Index - 1;
-					if (SectionEnd - SectionStart > 0)
+				const TArray<uint8>& Keyword = PngTextChunkInternal::GetTextChunkKeyword(CompressedData, Chunk);
+				const bool bIsReplaced = TextChunksToWrite.ContainsByPredicate(
+					[&Keyword](const PngTextChunkInternal::FTextChunkToWrite& TextChunkToWrite) -> bool
 					{
-						TArray<uint8> SplitTextChunk;
-						for (int32 CopyIndex = SectionStart; CopyIndex <= SectionEnd; CopyIndex++)
-						{
-							SplitTextChunk.Add(CompressedData[CopyIndex]);
-						}
-						SplitTextChunks.Add(SplitTextChunk);
+						return (TextChunkToWrite.Keyword == Keyword);
 					}
-
-					SectionStart = Index + 1;
-				}
-
-				if (SplitTextChunks.Num() == (Count + 1) * 2)
+				);
+				if (bIsReplaced)
 				{
-					break;
+					continue;
 				}
 			}
 
-			SearchStartPosition = SectionEnd;
+			NewCompressedData.Append(&CompressedData[Chunk.Offset], Chunk.GetTotalSize());
+		}
+
+		CompressedData = MoveTemp(NewCompressedData);
+		return FFileHelper::SaveArrayToFile(CompressedData, *Filename);
+	}
+
+	bool FPngTextChunk::EncodeTextChunks(const TMap<FString, FString>& MapToWrite, const ETextChunkFormat Format, TArray<uint8>& OutEncodedData)
+	{
+		TArray<PngTextChunkInternal::FTextChunkToWrite> TextChunksToWrite;
+		int64 TotalTextChunkSize = 0;
+		if (!PngTextChunkInternal::MakeTextChunks(MapToWrite, Format, TextChunksToWrite, TotalTextChunkSize))
+		{
+			return false;
+		}
+
+		OutEncodedData.Reset(static_cast<int32>(TotalTextChunkSize));
+		for (const auto& TextChunkToWrite : TextChunksToWrite)
+		{
+			PngTextChunkInternal::AppendChunk(OutEncodedData, TextChunkToWrite.Type, TextChunkToWrite.Data);
 		}
 
-		// Fails if the number of carved data is not the number of NumText x2.
-		if (SplitTextChunks.Num() != NumText * 2)
+		return true;
+	}
+
+	bool FPngTextChunk::Read(TMap<FString, FString>& MapToRead)
+	{
+		check(IsPng());
+
+		// Walks the chunks by their length so that the image data is never scanned.
+		TArray<PngTextChunkInternal::FPngChunk> Chunks;
+		if (!PngTextChunkInternal::ParseChunks(CompressedData, Chunks))
 		{
-			UE_LOG(LogGraphPrinter, Error, TEXT("------ The text could not be read correctly ------"));
-			UE_LOG(LogGraphPrinter, Error, TEXT("Number of texts retrieved from the library : %d"), NumText * 2);
-			UE_LOG(LogGraphPrinter, Error, TEXT("Number of texts actually retrieved         : %d"), SplitTextChunks.Num());
-			UE_LOG(LogGraphPrinter, Error, TEXT("--------------------------------------------------"));
+			UE_LOG(LogGraphPrinter, Error, TEXT("The chunks of the png file could not be read correctly."));
 			return false;
 		}
 
-		// Converts from a byte array to a string map.
-		for (int32 Index = 0; Index < SplitTextChunks.Num(); Index += 2)
+		for (const auto& Chunk : Chunks)
 		{
-			check(SplitTextChunks.IsValidIndex(Index) && SplitTextChunks.IsValidIndex(Index + 1));
+			if (!Chunk.IsTextChunk(CompressedData))
+			{
+				continue;
+			}
+
+			if (!Chunk.IsCrcValid(CompressedData))
+			{
+				UE_LOG(LogGraphPrinter, Error, TEXT("The CRC of the text chunk at offset %lld does not match."), Chunk.Offset);
+				return false;
+			}
 
-			const FString& Key = PngTextChunkInternal::ConvertByteArrayToString(SplitTextChunks[Index]);
-			const FString& Value = PngTextChunkInternal::ConvertByteArrayToString(SplitTextChunks[Index + 1]);
+			FString Key;
+			FString Value;
+			if (!PngTextChunkInternal::DecodeTextChunk(CompressedData, Chunk, Key, Value))
+			{
+				UE_LOG(LogGraphPrinter, Error, TEXT("The text chunk at offset %lld could not be decoded."), Chunk.Offset);
+				return false;
+			}
 
 			MapToRead.Add(Key, Value);
 		}
@@ -490,82 +717,81 @@ namespace TextChunkHelper
 		return IsPng();
 	}
 
-	bool FPngTextChunk::IsPng() const
-	{
-		if (CompressedData.Num() > PngTextChunkInternal::PngSignatureSize)
-		{
-			png_size_t PngSignature = *reinterpret_cast<const png_size_t*>(CompressedData.GetData());
-			return (0 == png_sig_cmp(reinterpret_cast<png_bytep>(&PngSignature), 0, PngTextChunkInternal::PngSignatureSize));
-		}
-
-		UE_LOG(LogGraphPrinter, Error, TEXT("This file is not a png file."));
-		return false;
-	}
-
-	void FPngTextChunk::UserReadCompressed(png_structp PngPtr, png_bytep Data, png_size_t Length)
+	bool FPngTextChunk::InitializeReadOnly(const FString& InFilename, IFileHandle& FileHandle)
 	{
-		FPngTextChunk* Context = static_cast<FPngTextChunk*>(png_get_io_ptr(PngPtr));
-		if (Context == nullptr)
-		{
-			const FString FunctionName = GET_FUNCTION_NAME_STRING_CHECKED(FPngTextChunk, UserReadCompressed);
-			UE_LOG(LogGraphPrinter, Fatal, TEXT("[%s] Context is invalid."), *FunctionName);
-		}
+		Filename = InFilename;
+		bIsReadOnly = true;
 
-		if (Context->ReadOffset + static_cast<int64>(Length) <= Context->CompressedData.Num())
+		const int64 FileSize = FileHandle.Size();
+		if (FileSize < PngTextChunkInternal::PngFileSignatureLength || !FileHandle.Seek(0))
 		{
-			FMemory::Memcpy(Data, &Context->CompressedData[Context->ReadOffset], Length);
-			Context->ReadOffset += Length;
+			return false;
 		}
-		else
+		
+		CompressedData.Reset();
+		CompressedData.SetNumUninitialized(PngTextChunkInternal::PngFileSignatureLength);
+		if (!FileHandle.Read(CompressedData.GetData(), PngTextChunkInternal::PngFileSignatureLength) || !IsPng())
 		{
-			UE_LOG(LogGraphPrinter, Error, TEXT("Invalid read position for CompressedData."));
+			return false;
 		}
-	}
 
-	void FPngTextChunk::UserWriteCompressed(png_structp PngPtr, png_bytep Data, png_size_t Length)
-	{
-		FPngTextChunk* Context = static_cast<FPngTextChunk*>(png_get_io_ptr(PngPtr));
-		if (Context == nullptr)
+		// Reads only the header of each chunk and seeks past the image data,
+		// so that the text chunks are loaded without reading the entire file.
+		int64 Offset = PngTextChunkInternal::PngFileSignatureLength;
+		while (Offset + 12 <= FileSize)
 		{
-			const FString FunctionName = GET_FUNCTION_NAME_STRING_CHECKED(FPngTextChunk, UserWriteCompressed);
-			UE_LOG(LogGraphPrinter, Fatal, TEXT("[%s] Context is invalid."), *FunctionName);
-		}
+			uint8 ChunkHeader[8];
+			if (!FileHandle.Seek(Offset) || !FileHandle.Read(ChunkHeader, sizeof(ChunkHeader)))
+			{
+				return false;
+			}
 
-		const int64 Offset = Context->CompressedData.AddUninitialized(Length);
-		FMemory::Memcpy(&Context->CompressedData[Offset], Data, Length);
-	}
+			const int64 TotalSize = static_cast<int64>(PngTextChunkInternal::ReadUInt32(ChunkHeader)) + 12;
+			if (Offset + TotalSize > FileSize)
+			{
+				UE_LOG(LogGraphPrinter, Error, TEXT("The chunks of the png file could not be read correctly."));
+				return false;
+			}
 
-	void FPngTextChunk::UserFlushData(png_structp PngPtr)
-	{
-	}
+			const uint8* ChunkType = &ChunkHeader[4];
+			const bool bIsImageEnd = PngTextChunkInternal::IsChunkType(ChunkType, PngTextChunkInternal::ImageEndChunkType);
+			if (bIsImageEnd || PngTextChunkInternal::IsTextChunkType(ChunkType))
+			{
+				// Copies the header, the data and the CRC so that the loaded data is also a valid png chunk sequence.
+				const int32 ChunkStartPosition = CompressedData.Num();
+				CompressedData.Append(ChunkHeader, sizeof(ChunkHeader));
+				CompressedData.AddUninitialized(static_cast<int32>(TotalSize) - sizeof(ChunkHeader));
+				if (!FileHandle.Read(&CompressedData[ChunkStartPosition + sizeof(ChunkHeader)], TotalSize - sizeof(ChunkHeader)))
+				{
+					return false;
+				}
+			}
 
-	void FPngTextChunk::UserError(png_structp PngPtr, png_const_charp ErrorMessage)
-	{
-		const FString ErrorMessageString = ANSI_TO_TCHAR(ErrorMessage);
-		UE_LOG(LogGraphPrinter, Error, TEXT("libpng Error : %s"), *ErrorMessageString);
-	}
+			if (bIsImageEnd)
+			{
+				return true;
+			}
 
-	void FPngTextChunk::UserWarning(png_structp PngPtr, png_const_charp WarningMessage)
-	{
-		const FString WarningMessageString = ANSI_TO_TCHAR(WarningMessage);
-		UE_LOG(LogGraphPrinter, Warning, TEXT("libpng Warning : %s"), *WarningMessageString);
-	}
+			Offset += TotalSize;
+		}
 
-	void* FPngTextChunk::UserMalloc(png_structp PngPtr, png_size_t Size)
-	{
-		check(Size > 0);
-		return FMemory::Malloc(Size);
+		UE_LOG(LogGraphPrinter, Error, TEXT("The chunks of the png file could not be read correctly."));
+		return false;
 	}
 
-	void FPngTextChunk::UserFree(png_structp PngPtr, png_voidp StructPtr)
+	bool FPngTextChunk::IsPng() const
 	{
-		check(StructPtr);
-		FMemory::Free(StructPtr);
+		// Only the signature has been read when opened in read-only mode, so the data may be exactly as long as the signature.
+		if (CompressedData.Num() >= PngTextChunkInternal::PngFileSignatureLength)
+		{
+			if (0 == png_sig_cmp(const_cast<png_bytep>(CompressedData.GetData()), 0, PngTextChunkInternal::PngFileSignatureLength))
+			{
+				return true;
+			}
+		}
+
+		UE_LOG(LogGraphPrinter, Error, TEXT("This file is not a png file."));
+		return false;
 	}
 }
-
-// Renables warning "interaction between '_setjmp' and C++ object destruction is non-portable".
-#ifdef _MSC_VER
-#pragma warning(pop)
-#endif
 #endif
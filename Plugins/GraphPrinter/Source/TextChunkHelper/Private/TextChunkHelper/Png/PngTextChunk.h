@@ -13,12 +13,8 @@ THIRD_PARTY_INCLUDES_START
 #if WITH_LIBPNG_1_6
 #if UE_5_06_OR_LATER
 #include "ThirdParty/libPNG/libPNG-1.6.44/png.h"
-#include "ThirdParty/libPNG/libPNG-1.6.44/pngstruct.h"
-#include "ThirdParty/libPNG/libPNG-1.6.44/pnginfo.h"
 #else
 #include "ThirdParty/libPNG/libPNG-1.6.37/png.h"
-#include "ThirdParty/libPNG/libPNG-1.6.37/pngstruct.h"
-#include "ThirdParty/libPNG/libPNG-1.6.37/pnginfo.h"
 #endif
 #else
 #include "ThirdParty/libPNG/libPNG-1.5.2/png.h"
@@ -36,35 +32,30 @@ namespace TextChunkHelper
 		// Constructor.
 		FPngTextChunk();
 
+		// Encodes the map as a sequence of text chunks that can be inserted before the image data of a png file.
+		static bool EncodeTextChunks(const TMap<FString, FString>& MapToWrite, const ETextChunkFormat Format, TArray<uint8>& OutEncodedData);
+
 	protected:
 		// ITextChunk interface.
-		virtual bool Write(const TMap<FString, FString>& MapToWrite) override;
+		virtual bool Write(const TMap<FString, FString>& MapToWrite, const ETextChunkFormat Format = ETextChunkFormat::Uncompressed) override;
 		virtual bool Read(TMap<FString, FString>& MapToRead) override;
 		virtual bool Initialize(const FString& InFilename, const void* InCompressedData, int64 InCompressedSize) override;
+		virtual bool InitializeReadOnly(const FString& InFilename, IFileHandle& FileHandle) override;
 		// End of ITextChunk interface.
 
 		// Checks if the format of the loaded image file is png.
 		virtual bool IsPng() const;
 
-		// Callbacks for the libpng.
-		static void UserReadCompressed(png_structp PngPtr, png_bytep Data, png_size_t Length);
-		static void UserWriteCompressed(png_structp PngPtr, png_bytep Data, png_size_t Length);
-		static void UserFlushData(png_structp PngPtr);
-		static void UserError(png_structp PngPtr, png_const_charp ErrorMessage);
-		static void UserWarning(png_structp PngPtr, png_const_charp WarningMessage);
-		static void* UserMalloc(png_structp PngPtr, png_size_t Size);
-		static void UserFree(png_structp PngPtr, png_voidp StructPtr);
-		// End of callbacks for the libpng.
-
 	protected:
 		// The file path of the original file.
 		FString Filename;
 
 		// The compressed raw data.
+		// In read-only mode, it contains only the signature, the text chunks and IEND.
 		TArray<uint8> CompressedData;
 
-		// The read offset into our array.
-		int64 ReadOffset;
+		// Whether only the text chunks are loaded and writing is not possible.
+		bool bIsReadOnly;
 	};
 }
 #endif
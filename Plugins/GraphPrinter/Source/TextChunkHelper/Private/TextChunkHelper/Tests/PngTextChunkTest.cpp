@@ -0,0 +1,141 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "TextChunkHelper/ITextChunkHelper.h"
+#include "TextChunkHelper/ITextChunk.h"
+#include "GraphPrinterGlobals/GraphPrinterGlobals.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace TextChunkHelper
+{
+	namespace PngTextChunkTest
+	{
+		// A valid 1x1 transparent png file without any text chunks.
+		static const uint8 EmptyPng[] = {
+			0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A,
+			0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+			0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+			0x08, 0x06, 0x00, 0x00, 0x00, 0x1F, 0x15, 0xC4,
+			0x89, 0x00, 0x00, 0x00, 0x0A, 0x49, 0x44, 0x41,
+			0x54, 0x78, 0x9C, 0x63, 0x00, 0x01, 0x00, 0x00,
+			0x05, 0x00, 0x01, 0x0D, 0x0A, 0x2D, 0xB4, 0x00,
+			0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE,
+			0x42, 0x60, 0x82,
+		};
+
+		// Returns the text written in the test, which contains both text that can and cannot be represented in Latin-1.
+		TMap<FString, FString> MakeMapToWrite()
+		{
+			TMap<FString, FString> MapToWrite;
+			MapToWrite.Add(TEXT("Ascii"), TEXT("Begin Object Class=/Script/BlueprintGraph.K2Node_CallFunction Name=\"K2Node_CallFunction_0\""));
+			MapToWrite.Add(TEXT("Latin1"), TEXT("Caf\u00E9 na\u00EFve \u00D7 \u00FF"));
+			MapToWrite.Add(TEXT("Unicode"), TEXT("\u30B0\u30E9\u30D5 \u56FE\u8868 \u0413\u0440\u0430\u0444"));
+			return MapToWrite;
+		}
+
+		// Returns whether the read text matches the written text.
+		bool AreMapsEqual(const TMap<FString, FString>& Expected, const TMap<FString, FString>& Actual)
+		{
+			if (Expected.Num() != Actual.Num())
+			{
+				return false;
+			}
+
+			for (const auto& Pair : Expected)
+			{
+				const FString* Value = Actual.Find(Pair.Key);
+				if (Value == nullptr || !Value->Equals(Pair.Value, ESearchCase::CaseSensitive))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPngTextChunkRoundTripTest,
+	"GraphPrinter.TextChunkHelper.PngTextChunk.RoundTrip",
+#if UE_5_05_OR_LATER
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter
+#else
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter
+#endif
+)
+
+bool FPngTextChunkRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace TextChunkHelper;
+
+	const ITextChunkHelper& TextChunkHelper = ITextChunkHelper::Get();
+	const TMap<FString, FString> MapToWrite = PngTextChunkTest::MakeMapToWrite();
+
+	const TPair<ETextChunkFormat, const TCHAR*> Formats[] = {
+		{ ETextChunkFormat::Uncompressed, TEXT("Uncompressed") },
+		{ ETextChunkFormat::Compressed, TEXT("Compressed") },
+		{ ETextChunkFormat::CompressedUnicode, TEXT("CompressedUnicode") },
+	};
+
+	TArray<FString> Filenames;
+	for (const auto& Format : Formats)
+	{
+		const FString Filename = FPaths::Combine(
+			FPaths::AutomationTransientDir(),
+			TEXT("GraphPrinter"),
+			FString::Printf(TEXT("PngTextChunk_%s.png"), Format.Value)
+		);
+		Filenames.Add(Filename);
+
+		const TSharedPtr<ITextChunk> TextChunkToWrite = TextChunkHelper.CreateTextChunkFromMemory(Filename, PngTextChunkTest::EmptyPng, sizeof(PngTextChunkTest::EmptyPng));
+		if (!TestTrue(FString::Printf(TEXT("Created the text chunk of the encoded png (%s)"), Format.Value), TextChunkToWrite.IsValid()))
+		{
+			continue;
+		}
+		if (!TestTrue(FString::Printf(TEXT("Wrote the text chunks (%s)"), Format.Value), TextChunkToWrite->Write(MapToWrite, Format.Key)))
+		{
+			continue;
+		}
+
+		for (const ETextChunkOpenMode OpenMode : { ETextChunkOpenMode::ReadWrite, ETextChunkOpenMode::ReadOnly })
+		{
+			const TCHAR* OpenModeName = (OpenMode == ETextChunkOpenMode::ReadOnly) ? TEXT("ReadOnly") : TEXT("ReadWrite");
+
+			const TSharedPtr<ITextChunk> TextChunkToRead = TextChunkHelper.CreateTextChunk(Filename, OpenMode);
+			if (!TestTrue(FString::Printf(TEXT("Opened the written png (%s, %s)"), Format.Value, OpenModeName), TextChunkToRead.IsValid()))
+			{
+				continue;
+			}
+
+			TMap<FString, FString> MapToRead;
+			TestTrue(FString::Printf(TEXT("Read the text chunks (%s, %s)"), Format.Value, OpenModeName), TextChunkToRead->Read(MapToRead));
+			TestTrue(FString::Printf(TEXT("The read text matches the written text (%s, %s)"), Format.Value, OpenModeName), PngTextChunkTest::AreMapsEqual(MapToWrite, MapToRead));
+		}
+	}
+
+	TArray<TMap<FString, FString>> MapsToRead;
+	TArray<bool> Results;
+	TextChunkHelper.ReadTextChunksInParallel(Filenames, MapsToRead, Results);
+	if (TestEqual(TEXT("The number of results of reading in parallel"), Results.Num(), Filenames.Num()))
+	{
+		for (int32 Index = 0; Index < Filenames.Num(); Index++)
+		{
+			TestTrue(FString::Printf(TEXT("Read the text chunks in parallel (%s)"), *FPaths::GetCleanFilename(Filenames[Index])), Results[Index]);
+			TestTrue(FString::Printf(TEXT("The text read in parallel matches the written text (%s)"), *FPaths::GetCleanFilename(Filenames[Index])), PngTextChunkTest::AreMapsEqual(MapToWrite, MapsToRead[Index]));
+		}
+	}
+
+	for (const FString& Filename : Filenames)
+	{
+		IFileManager::Get().Delete(*Filename, false, true, true);
+	}
+
+	return true;
+}
+
+#endif
@@ -3,7 +3,8 @@
 #include "TextChunkHelper/ITextChunkHelper.h"
 #include "GraphPrinterGlobals/GraphPrinterGlobals.h"
 #include "UObject/Class.h"
-#include "Misc/FileHelper.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/ParallelFor.h"
 #include "IImageWrapper.h"
 #include "IImageWrapperModule.h"
 #if WITH_UNREALPNG
@@ -23,7 +24,25 @@ namespace TextChunkHelper
 		// End of IModuleInterface interface.
 
 		// ITextChunkHelper interface.
-		virtual TSharedPtr<ITextChunk> CreateTextChunk(const FString& InFilename) const override;
+		virtual TSharedPtr<ITextChunk> CreateTextChunk(const FString& InFilename, const ETextChunkOpenMode OpenMode) const override;
+		virtual TSharedPtr<ITextChunk> CreateTextChunkFromMemory(const FString& InFilename, const void* InCompressedData, const int64 InCompressedSize) const override;
+		virtual void ReadTextChunksInParallel(
+			const TArray<FString>& InFilenames,
+			TArray<TMap<FString, FString>>& OutMaps,
+			TArray<bool>& OutResults
+		) const override;
+		virtual void WriteTextChunksInParallel(
+			const TArray<FString>& InFilenames,
+			const TArray<TMap<FString, FString>>& MapsToWrite,
+			const ETextChunkFormat Format,
+			TArray<bool>& OutResults
+		) const override;
+		virtual bool EncodeTextChunks(
+			const EDesiredImageFormat ImageFormat,
+			const TMap<FString, FString>& MapToWrite,
+			const ETextChunkFormat Format,
+			TArray<uint8>& OutEncodedData
+		) const override;
 		virtual bool IsSupportedImageFormat(const EDesiredImageFormat ImageFormat) const override;
 		virtual void RegisterTextChunkGenerator(
 			const EDesiredImageFormat ImageFormat,
@@ -32,13 +51,22 @@ namespace TextChunkHelper
 		virtual void UnregisterTextChunkGenerator(const EDesiredImageFormat ImageFormat) override;
 		// End of ITextChunkHelper interface.
 
+	private:
+		// Detects the image format from the beginning of the image data and generates an uninitialized text chunk for it.
+		TSharedPtr<ITextChunk> GenerateTextChunk(const void* InCompressedData, const int64 InCompressedSize) const;
+
 	private:
 		// The text chunk generation process for each image format.
 		TMap<EDesiredImageFormat, FOnCreateTextChunk> GenerationProcesses;
+
+		// The image wrapper module loaded on the game thread so that the image format can be detected on worker threads.
+		IImageWrapperModule* ImageWrapperModule = nullptr;
 	};
 	
 	void FTextChunkHelperModule::StartupModule()
 	{
+		ImageWrapperModule = &FModuleManager::LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+		
 #if WITH_UNREALPNG
 		RegisterTextChunkGenerator(
 			EDesiredImageFormat::PNG,
@@ -57,17 +85,155 @@ namespace TextChunkHelper
 #if WITH_UNREALPNG
 		UnregisterTextChunkGenerator(EDesiredImageFormat::PNG);
 #endif
+
+		ImageWrapperModule = nullptr;
 	}
 
-	TSharedPtr<ITextChunk> FTextChunkHelperModule::CreateTextChunk(const FString& InFilename) const
+	TSharedPtr<ITextChunk> FTextChunkHelperModule::CreateTextChunk(const FString& InFilename, const ETextChunkOpenMode OpenMode) const
 	{
+		const TUniquePtr<IFileHandle> FileHandle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*InFilename));
+		if (!FileHandle.IsValid())
+		{
+			UE_LOG(LogGraphPrinter, Error, TEXT("Failed to load the file : %s"), *InFilename);
+			return nullptr;
+		}
+
+		// Only the beginning of the file is needed to detect the image format.
+		static constexpr int64 ImageFormatHeaderSize = 64;
 		TArray<uint8> CompressedData;
-		if (!FFileHelper::LoadFileToArray(CompressedData, *InFilename))
+		CompressedData.SetNumUninitialized(static_cast<int32>(
+			(OpenMode == ETextChunkOpenMode::ReadOnly) ? FMath::Min(FileHandle->Size(), ImageFormatHeaderSize) : FileHandle->Size()
+		));
+		if (CompressedData.Num() == 0 || !FileHandle->Read(CompressedData.GetData(), CompressedData.Num()))
 		{
 			UE_LOG(LogGraphPrinter, Error, TEXT("Failed to load the file : %s"), *InFilename);
 			return nullptr;
 		}
 
+		const TSharedPtr<ITextChunk> TextChunk = GenerateTextChunk(CompressedData.GetData(), CompressedData.Num());
+		if (!TextChunk.IsValid())
+		{
+			return nullptr;
+		}
+
+		const ITextChunk::FInitializer Initializer(TextChunk.Get());
+		if (OpenMode == ETextChunkOpenMode::ReadOnly)
+		{
+			if (!Initializer.InitializeReadOnly(InFilename, *FileHandle))
+			{
+				return nullptr;
+			}
+		}
+		else
+		{
+			if (!Initializer.Initialize(InFilename, CompressedData.GetData(), CompressedData.Num()))
+			{
+				return nullptr;
+			}
+		}
+		
+		return TextChunk;
+	}
+
+	TSharedPtr<ITextChunk> FTextChunkHelperModule::CreateTextChunkFromMemory(const FString& InFilename, const void* InCompressedData, const int64 InCompressedSize) const
+	{
+		if (InCompressedData == nullptr || InCompressedSize <= 0)
+		{
+			return nullptr;
+		}
+		
+		const TSharedPtr<ITextChunk> TextChunk = GenerateTextChunk(InCompressedData, InCompressedSize);
+		if (!TextChunk.IsValid())
+		{
+			return nullptr;
+		}
+
+		const ITextChunk::FInitializer Initializer(TextChunk.Get());
+		if (!Initializer.Initialize(InFilename, InCompressedData, InCompressedSize))
+		{
+			return nullptr;
+		}
+
+		return TextChunk;
+	}
+
+	void FTextChunkHelperModule::ReadTextChunksInParallel(
+		const TArray<FString>& InFilenames,
+		TArray<TMap<FString, FString>>& OutMaps,
+		TArray<bool>& OutResults
+	) const
+	{
+		OutMaps.Reset();
+		OutMaps.SetNum(InFilenames.Num());
+		OutResults.Reset();
+		OutResults.SetNumZeroed(InFilenames.Num());
+
+		// Each text chunk has its own data, so files can be processed independently.
+		ParallelFor(
+			InFilenames.Num(),
+			[&](const int32 Index)
+			{
+				const TSharedPtr<ITextChunk> TextChunk = CreateTextChunk(InFilenames[Index], ETextChunkOpenMode::ReadOnly);
+				if (TextChunk.IsValid() && TextChunk->Read(OutMaps[Index]))
+				{
+					OutResults[Index] = true;
+				}
+				else
+				{
+					OutMaps[Index].Reset();
+				}
+			}
+		);
+	}
+
+	void FTextChunkHelperModule::WriteTextChunksInParallel(
+		const TArray<FString>& InFilenames,
+		const TArray<TMap<FString, FString>>& MapsToWrite,
+		const ETextChunkFormat Format,
+		TArray<bool>& OutResults
+	) const
+	{
+		check(InFilenames.Num() == MapsToWrite.Num());
+		
+		OutResults.Reset();
+		OutResults.SetNumZeroed(InFilenames.Num());
+
+		// Each text chunk has its own data, so files can be processed independently.
+		ParallelFor(
+			InFilenames.Num(),
+			[&](const int32 Index)
+			{
+				const TSharedPtr<ITextChunk> TextChunk = CreateTextChunk(InFilenames[Index], ETextChunkOpenMode::ReadWrite);
+				OutResults[Index] = (TextChunk.IsValid() && TextChunk->Write(MapsToWrite[Index], Format));
+			}
+		);
+	}
+
+	bool FTextChunkHelperModule::EncodeTextChunks(
+		const EDesiredImageFormat ImageFormat,
+		const TMap<FString, FString>& MapToWrite,
+		const ETextChunkFormat Format,
+		TArray<uint8>& OutEncodedData
+	) const
+	{
+#if WITH_UNREALPNG
+		if (ImageFormat == EDesiredImageFormat::PNG)
+		{
+			return FPngTextChunk::EncodeTextChunks(MapToWrite, Format, OutEncodedData);
+		}
+#endif
+
+		UE_LOG(LogGraphPrinter, Error, TEXT("The text chunks of %s cannot be encoded without the image data."), *UEnum::GetDisplayValueAsText(ImageFormat).ToString());
+		return false;
+	}
+
+	bool FTextChunkHelperModule::IsSupportedImageFormat(const EDesiredImageFormat ImageFormat) const
+	{
+		return GenerationProcesses.Contains(ImageFormat);
+	}
+
+	TSharedPtr<ITextChunk> FTextChunkHelperModule::GenerateTextChunk(const void* InCompressedData, const int64 InCompressedSize) const
+	{
 		auto ToDesiredImageFormat = [](const EImageFormat ImageFormat) -> TOptional<EDesiredImageFormat>
 		{
 			switch (ImageFormat)
@@ -87,11 +253,11 @@ namespace TextChunkHelper
 			return {};
 		};
 
-		auto& ImageWrapper = FModuleManager::LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+		check(ImageWrapperModule != nullptr);
 		const TOptional<EDesiredImageFormat> ImageFormat = ToDesiredImageFormat(
-			ImageWrapper.DetectImageFormat(
-				CompressedData.GetData(),
-				CompressedData.Num()
+			ImageWrapperModule->DetectImageFormat(
+				InCompressedData,
+				InCompressedSize
 			)
 		);
 		if (!ImageFormat.IsSet())
@@ -107,24 +273,7 @@ namespace TextChunkHelper
 
 		check(GenerationProcess->IsBound());
 
-		TSharedPtr<ITextChunk> TextChunk = GenerationProcess->Execute();
-		if (!TextChunk.IsValid())
-		{
-			return nullptr;
-		}
-
-		const ITextChunk::FInitializer Initializer(TextChunk.Get());
-		if (!Initializer.Initialize(InFilename, CompressedData.GetData(), CompressedData.Num()))
-		{
-			return nullptr;
-		}
-		
-		return TextChunk;
-	}
-
-	bool FTextChunkHelperModule::IsSupportedImageFormat(const EDesiredImageFormat ImageFormat) const
-	{
-		return GenerationProcesses.Contains(ImageFormat);
+		return GenerationProcess->Execute();
 	}
 
 	void FTextChunkHelperModule::RegisterTextChunkGenerator(
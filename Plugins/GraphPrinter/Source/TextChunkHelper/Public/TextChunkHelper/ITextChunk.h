@@ -3,9 +3,39 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GenericPlatform/GenericPlatformFile.h"
 
 namespace TextChunkHelper
 {
+	/**
+	 * An enum class that defines how text is stored in the text chunk.
+	 */
+	enum class ETextChunkFormat : uint8
+	{
+		// The text is stored as it is (tEXt in png files).
+		// The text that cannot be represented in Latin-1 is stored in UTF-8 (iTXt in png files).
+		Uncompressed,
+
+		// The text is compressed (zTXt in png files).
+		// The text that cannot be represented in Latin-1 is encoded in UTF-8 and compressed (iTXt in png files).
+		Compressed,
+
+		// The text is encoded in UTF-8 and compressed (iTXt in png files).
+		CompressedUnicode,
+	};
+
+	/**
+	 * An enum class that defines how the image file is opened.
+	 */
+	enum class ETextChunkOpenMode : uint8
+	{
+		// Loads the entire image file so that the text chunks can be written.
+		ReadWrite,
+
+		// Loads only the parts of the image file needed to read the text chunks.
+		ReadOnly,
+	};
+	
 	/**
 	 * An interface for manipulating text chunks in image files.
 	 */
@@ -16,7 +46,7 @@ namespace TextChunkHelper
 		virtual ~ITextChunk() = default;
 		
 		// Writes to text chunk of image file.
-		virtual bool Write(const TMap<FString, FString>& MapToWrite) = 0;
+		virtual bool Write(const TMap<FString, FString>& MapToWrite, const ETextChunkFormat Format = ETextChunkFormat::Uncompressed) = 0;
 
 		// Reads into text chunks in image files.
 		virtual bool Read(TMap<FString, FString>& MapToRead) = 0;
@@ -25,6 +55,26 @@ namespace TextChunkHelper
 		// Copies loaded data to member variables.
 		virtual bool Initialize(const FString& InFilename, const void* InCompressedData, const int64 InCompressedSize) = 0;
 
+		// Loads only the data needed to read the text chunks from the opened file.
+		// By default, the entire file is loaded as it is not known where the text chunks are in the file.
+		virtual bool InitializeReadOnly(const FString& InFilename, IFileHandle& FileHandle)
+		{
+			const int64 FileSize = FileHandle.Size();
+			if (FileSize <= 0 || !FileHandle.Seek(0))
+			{
+				return false;
+			}
+
+			TArray<uint8> CompressedData;
+			CompressedData.SetNumUninitialized(FileSize);
+			if (!FileHandle.Read(CompressedData.GetData(), FileSize))
+			{
+				return false;
+			}
+
+			return Initialize(InFilename, CompressedData.GetData(), CompressedData.Num());
+		}
+
 	public:
 		// Partial friend for calling initialization from the factory class of the module class.
 		struct FInitializer
@@ -38,6 +88,10 @@ namespace TextChunkHelper
 			{
 				return This->Initialize(InFilename, InCompressedData, InCompressedSize);
 			}
+			bool InitializeReadOnly(const FString& InFilename, IFileHandle& FileHandle) const
+			{
+				return This->InitializeReadOnly(InFilename, FileHandle);
+			}
 		};
 	};
 }
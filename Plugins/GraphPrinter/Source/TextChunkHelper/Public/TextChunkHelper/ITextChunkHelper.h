@@ -35,8 +35,39 @@ namespace TextChunkHelper
 		}
 
 		// Returns a class of text chunks depending on the type of image file.
-		virtual TSharedPtr<ITextChunk> CreateTextChunk(const FString& InFilename) const = 0;
+		// In read-only mode, only the parts of the file needed to read the text chunks are loaded and writing fails.
+		virtual TSharedPtr<ITextChunk> CreateTextChunk(const FString& InFilename, const ETextChunkOpenMode OpenMode = ETextChunkOpenMode::ReadWrite) const = 0;
 
+		// Returns a class of text chunks for the image data that has been encoded in memory but not yet written.
+		// Writing the text chunk saves the image data including the text chunks to the specified file.
+		virtual TSharedPtr<ITextChunk> CreateTextChunkFromMemory(const FString& InFilename, const void* InCompressedData, const int64 InCompressedSize) const = 0;
+
+		// Reads the text chunks of multiple image files in parallel on worker threads.
+		// The results are stored at the same index as the file name, and files that failed to read have an empty map and false.
+		virtual void ReadTextChunksInParallel(
+			const TArray<FString>& InFilenames,
+			TArray<TMap<FString, FString>>& OutMaps,
+			TArray<bool>& OutResults
+		) const = 0;
+
+		// Writes the text chunks of multiple image files in parallel on worker threads.
+		// The results are stored at the same index as the file name.
+		virtual void WriteTextChunksInParallel(
+			const TArray<FString>& InFilenames,
+			const TArray<TMap<FString, FString>>& MapsToWrite,
+			const ETextChunkFormat Format,
+			TArray<bool>& OutResults
+		) const = 0;
+		
+		// Encodes the map as text chunks of the specified image format without any image data.
+		// The encoded data can be written before the image data by writers that write the image file in a streaming way.
+		virtual bool EncodeTextChunks(
+			const EDesiredImageFormat ImageFormat,
+			const TMap<FString, FString>& MapToWrite,
+			const ETextChunkFormat Format,
+			TArray<uint8>& OutEncodedData
+		) const = 0;
+		
 		// Returns whether text chunks in the specified image format is supported.
 		virtual bool IsSupportedImageFormat(const EDesiredImageFormat ImageFormat) const = 0;
 		
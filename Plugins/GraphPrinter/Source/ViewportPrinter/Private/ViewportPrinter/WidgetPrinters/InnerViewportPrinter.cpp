@@ -63,26 +63,9 @@ namespace GraphPrinter
 
 	TSharedPtr<SViewport> FViewportPrinter::FindTargetWidgetFromSearchTarget(const TSharedPtr<SWidget>& SearchTarget)
 	{
-		TSharedPtr<SViewport> FoundViewport = GP_CAST_SLATE_WIDGET(SViewport, SearchTarget);
-		if (!FoundViewport.IsValid())
-		{
-			FWidgetPrinterUtils::EnumerateChildWidgets(
-				SearchTarget,
-				[&](const TSharedPtr<SWidget>& ChildWidget) -> bool
-				{
-					const TSharedPtr<SViewport> Viewport = GP_CAST_SLATE_WIDGET(SViewport, ChildWidget);
-					if (Viewport.IsValid())
-					{
-						FoundViewport = Viewport;
-						return false;
-					}
-
-					return true;
-				}
-			);
-		}
-		
-		return FoundViewport;
+		return StaticCastSharedPtr<SViewport>(
+			FWidgetPrinterUtils::FindNearestChildWidget(SearchTarget, GP_SLATE_WIDGET_TYPE_NAME(SViewport))
+		);
 	}
 
 	bool FViewportPrinter::GetViewportTitle(const TSharedPtr<SViewport>& Viewport, FString& Title)
@@ -2,6 +2,7 @@
 
 #include "ViewportPrinter/WidgetPrinters/ViewportPrinter.h"	
 #include "ViewportPrinter/WidgetPrinters/InnerViewportPrinter.h"
+#include "WidgetPrinter/Utilities/CastSlateWidget.h"
 #include "GraphPrinterGlobals/GraphPrinterGlobals.h"
 
 #if UE_5_01_OR_LATER
@@ -30,6 +31,11 @@ TOptional<GraphPrinter::FSupportedWidget> UViewportPrinter::CheckIfSupported(con
 	return GraphPrinter::FSupportedWidget(Viewport.ToSharedRef(), ViewportTitle, GetPriority());
 }
 
+TArray<FName> UViewportPrinter::GetSupportedWidgetTypeNames() const
+{
+	return { GP_SLATE_WIDGET_TYPE_NAME(SViewport) };
+}
+
 TSharedRef<GraphPrinter::IInnerWidgetPrinter> UViewportPrinter::CreatePrintModeInnerPrinter(const FSimpleDelegate& OnPrinterProcessingFinished) const
 {
 	return MakeShared<GraphPrinter::FViewportPrinter>(
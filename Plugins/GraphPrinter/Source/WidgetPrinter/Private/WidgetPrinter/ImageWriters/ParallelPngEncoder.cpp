@@ -0,0 +1,791 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#include "WidgetPrinter/ImageWriters/ParallelPngEncoder.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformMisc.h"
+#include <atomic>
+
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
+namespace GraphPrinter
+{
+	namespace ParallelPngEncoderInternal
+	{
+		// The color types defined in the png specification that the encoder writes.
+		static constexpr uint8 ColorTypeRgb = 2;
+		static constexpr uint8 ColorTypeIndexed = 3;
+		static constexpr uint8 ColorTypeRgba = 6;
+
+		// The maximum number of colors in the palette.
+		static constexpr int32 MaxPaletteSize = 256;
+
+		// The number of filter types defined in the png specification.
+		static constexpr int32 NumFilterTypes = 5;
+
+		// The maximum size of the dictionary that deflate can refer to.
+		static constexpr int32 MaxDictionarySize = 32 * 1024;
+
+		// The approximate size of the filtered rows compressed as one band.
+		static constexpr int64 TargetBandSize = 1024 * 1024;
+
+		// The size of the length and type at the beginning of a chunk and the crc at the end.
+		static constexpr int32 ChunkHeaderSize = 8;
+		static constexpr int32 ChunkFooterSize = 4;
+
+		// Writes the value in big endian as required by png.
+		void WriteUint32(uint8* Destination, const uint32 Value)
+		{
+			Destination[0] = static_cast<uint8>(Value >> 24);
+			Destination[1] = static_cast<uint8>(Value >> 16);
+			Destination[2] = static_cast<uint8>(Value >> 8);
+			Destination[3] = static_cast<uint8>(Value);
+		}
+
+		// Calculates the checksum of large data by dividing it into the sizes that zlib accepts.
+		template<typename TChecksumFunction>
+		uLong CalculateChecksum(uLong Checksum, const uint8* Data, int64 Size, TChecksumFunction ChecksumFunction)
+		{
+			while (Size > 0)
+			{
+				const uInt SizeToProcess = static_cast<uInt>(FMath::Min<int64>(Size, MAX_uint32));
+				Checksum = ChecksumFunction(Checksum, Data, SizeToProcess);
+				Data += SizeToProcess;
+				Size -= SizeToProcess;
+			}
+
+			return Checksum;
+		}
+
+		// Fills in the length and crc of the chunk whose type and data are already written.
+		void FinishChunk(uint8* Chunk, const uint32 DataSize)
+		{
+			WriteUint32(Chunk, DataSize);
+
+			const uLong Crc = CalculateChecksum(crc32(0, nullptr, 0), Chunk + 4, 4 + static_cast<int64>(DataSize), crc32);
+			WriteUint32(Chunk + ChunkHeaderSize + DataSize, static_cast<uint32>(Crc));
+		}
+
+		// Appends a chunk with the specified type and data.
+		void AppendChunk(TArray64<uint8>& OutData, const char* Type, const uint8* Data, const uint32 DataSize)
+		{
+			const int64 ChunkOffset = OutData.AddUninitialized(ChunkHeaderSize + DataSize + ChunkFooterSize);
+			uint8* Chunk = OutData.GetData() + ChunkOffset;
+			FMemory::Memcpy(Chunk + 4, Type, 4);
+			if (DataSize > 0)
+			{
+				FMemory::Memcpy(Chunk + ChunkHeaderSize, Data, DataSize);
+			}
+			FinishChunk(Chunk, DataSize);
+		}
+
+		// Returns the number of rows in a band so that each band is compressed with enough data.
+		int32 GetRowsPerBand(const int64 NumFilteredRowBytes)
+		{
+			return static_cast<int32>(FMath::Max<int64>(TargetBandSize / NumFilteredRowBytes, 1));
+		}
+
+		// Returns the predictor of the paeth filter.
+		FORCEINLINE uint8 PaethPredictor(const uint8 Left, const uint8 Above, const uint8 UpperLeft)
+		{
+			const int32 Estimate = static_cast<int32>(Left) + Above - UpperLeft;
+			const int32 DistanceToLeft = FMath::Abs(Estimate - Left);
+			const int32 DistanceToAbove = FMath::Abs(Estimate - Above);
+			const int32 DistanceToUpperLeft = FMath::Abs(Estimate - UpperLeft);
+			if (DistanceToLeft <= DistanceToAbove && DistanceToLeft <= DistanceToUpperLeft)
+			{
+				return Left;
+			}
+			if (DistanceToAbove <= DistanceToUpperLeft)
+			{
+				return Above;
+			}
+			return UpperLeft;
+		}
+
+		// Converts a row of FColor arranged in BGRA to the bytes of the format.
+		void ConvertRow(const FColor* Row, const int32 Width, const FParallelPngEncoder::FPixelFormat& Format, uint8* OutRow)
+		{
+			if (Format.IsIndexed())
+			{
+				// Neighboring pixels often have the same color, so the last index is reused without searching the map.
+				FColor LastColor = Row[0];
+				uint8 LastIndex = Format.PaletteIndices.FindChecked(LastColor);
+
+				const int32 PixelsPerByte = 8 / Format.BitDepth;
+				FMemory::Memzero(OutRow, Format.GetNumRowBytes(Width));
+				for (int32 Index = 0; Index < Width; Index++)
+				{
+					if (Row[Index] != LastColor)
+					{
+						LastColor = Row[Index];
+						LastIndex = Format.PaletteIndices.FindChecked(LastColor);
+					}
+
+					// The pixels smaller than a byte are packed from the most significant bit.
+					const int32 Shift = 8 - Format.BitDepth * (Index % PixelsPerByte + 1);
+					OutRow[Index / PixelsPerByte] |= static_cast<uint8>(LastIndex << Shift);
+				}
+				return;
+			}
+
+			const bool bHasAlpha = (Format.ColorType == ColorTypeRgba);
+			for (int32 Index = 0; Index < Width; Index++)
+			{
+				OutRow[0] = Row[Index].R;
+				OutRow[1] = Row[Index].G;
+				OutRow[2] = Row[Index].B;
+				if (bHasAlpha)
+				{
+					OutRow[3] = Row[Index].A;
+				}
+				OutRow += Format.BytesPerPixel;
+			}
+		}
+
+		// Filters a row with every filter type and writes the one with the smallest sum of absolute differences,
+		// which is the same heuristic that libpng uses by default.
+		void FilterRow(const uint8* Current, const uint8* Previous, const int32 NumRowBytes, const int32 BytesPerPixel, uint8* Candidates, uint8* OutFilteredRow)
+		{
+			int64 BestSum = MAX_int64;
+			int32 BestFilterType = 0;
+			for (int32 FilterType = 0; FilterType < NumFilterTypes; FilterType++)
+			{
+				uint8* Candidate = Candidates + static_cast<int64>(FilterType) * NumRowBytes;
+				int64 Sum = 0;
+				for (int32 Index = 0; Index < NumRowBytes; Index++)
+				{
+					const uint8 Left = (Index >= BytesPerPixel) ? Current[Index - BytesPerPixel] : 0;
+					const uint8 Above = Previous[Index];
+					const uint8 UpperLeft = (Index >= BytesPerPixel) ? Previous[Index - BytesPerPixel] : 0;
+
+					uint8 Predictor = 0;
+					switch (FilterType)
+					{
+					case 1: Predictor = Left; break;
+					case 2: Predictor = Above; break;
+					case 3: Predictor = static_cast<uint8>((static_cast<int32>(Left) + Above) / 2); break;
+					case 4: Predictor = PaethPredictor(Left, Above, UpperLeft); break;
+					default: break;
+					}
+
+					const uint8 Filtered = static_cast<uint8>(Current[Index] - Predictor);
+					Candidate[Index] = Filtered;
+					Sum += FMath::Abs(static_cast<int32>(static_cast<int8>(Filtered)));
+				}
+
+				if (Sum < BestSum)
+				{
+					BestSum = Sum;
+					BestFilterType = FilterType;
+				}
+			}
+
+			OutFilteredRow[0] = static_cast<uint8>(BestFilterType);
+			FMemory::Memcpy(OutFilteredRow + 1, Candidates + static_cast<int64>(BestFilterType) * NumRowBytes, NumRowBytes);
+		}
+
+		// Filters the rows. If there is no previous row, the rows start at the top of the image.
+		void FilterRows(
+			const FColor* Rows,
+			const FColor* PreviousRow,
+			const int32 Width,
+			const int32 NumRows,
+			const FParallelPngEncoder::FPixelFormat& Format,
+			uint8* OutFilteredRows
+		)
+		{
+			const int32 NumRowBytes = static_cast<int32>(Format.GetNumRowBytes(Width));
+
+			// The palette indices are not continuous values, so they are written without filtering as the png specification recommends.
+			if (Format.IsIndexed())
+			{
+				for (int32 Row = 0; Row < NumRows; Row++)
+				{
+					uint8* FilteredRow = OutFilteredRows + static_cast<int64>(Row) * (NumRowBytes + 1);
+					FilteredRow[0] = 0;
+					ConvertRow(Rows + static_cast<int64>(Row) * Width, Width, Format, FilteredRow + 1);
+				}
+				return;
+			}
+
+			TArray<uint8> Previous;
+			Previous.SetNumZeroed(NumRowBytes);
+			if (PreviousRow != nullptr)
+			{
+				ConvertRow(PreviousRow, Width, Format, Previous.GetData());
+			}
+
+			TArray<uint8> Current;
+			Current.SetNumUninitialized(NumRowBytes);
+
+			TArray<uint8> Candidates;
+			Candidates.SetNumUninitialized(NumRowBytes * NumFilterTypes);
+
+			for (int32 Row = 0; Row < NumRows; Row++)
+			{
+				ConvertRow(Rows + static_cast<int64>(Row) * Width, Width, Format, Current.GetData());
+				FilterRow(
+					Current.GetData(),
+					Previous.GetData(),
+					NumRowBytes,
+					Format.BytesPerPixel,
+					Candidates.GetData(),
+					OutFilteredRows + static_cast<int64>(Row) * (NumRowBytes + 1)
+				);
+				Swap(Previous, Current);
+			}
+		}
+
+		// Returns the zlib stream header for the compression level.
+		void GetZlibHeader(const int32 CompressionLevel, uint8& OutCmf, uint8& OutFlg)
+		{
+			// Deflate with a 32K window.
+			OutCmf = 0x78;
+
+			uint8 CompressionLevelFlag = 2;
+			if (CompressionLevel >= 0)
+			{
+				if (CompressionLevel < 2)
+				{
+					CompressionLevelFlag = 0;
+				}
+				else if (CompressionLevel < 6)
+				{
+					CompressionLevelFlag = 1;
+				}
+				else if (CompressionLevel > 6)
+				{
+					CompressionLevelFlag = 3;
+				}
+			}
+
+			// The header must be a multiple of 31 when viewed as a 16-bit value.
+			OutFlg = static_cast<uint8>(CompressionLevelFlag << 6);
+			OutFlg |= static_cast<uint8>((31 - (OutCmf * 256 + OutFlg) % 31) % 31);
+		}
+	}
+
+	bool FParallelPngEncoder::Encode(
+		const FIntPoint& ImageSize,
+		const FColor* Pixels,
+		const int32 CompressionQuality,
+		TArray64<uint8>& OutPngData,
+		const EPngColorReduction ColorReduction
+	)
+	{
+		if (Pixels == nullptr || ImageSize.X <= 0 || ImageSize.Y <= 0)
+		{
+			return false;
+		}
+
+		const int32 CompressionLevel = GetCompressionLevel(CompressionQuality);
+		const FPixelFormat Format = AnalyzePixels(ImageSize, Pixels, ColorReduction);
+
+		TArray<TSharedRef<FBand, ESPMode::ThreadSafe>> Bands;
+		CreateBands(ImageSize, Format, Pixels, 0, ImageSize.Y, nullptr, {}, Bands);
+
+		// Uses the task graph instead of the thread pool so that the calling thread can take part even if it is a worker thread.
+		ParallelFor(
+			Bands.Num(),
+			[&Bands, CompressionLevel](const int32 BandIndex)
+			{
+				CompressBand(*Bands[BandIndex], CompressionLevel);
+			}
+		);
+
+		OutPngData.Reset();
+		AppendImageHeader(OutPngData, ImageSize, Format);
+
+		uLong Adler = adler32(0, nullptr, 0);
+		for (const TSharedRef<FBand, ESPMode::ThreadSafe>& Band : Bands)
+		{
+			if (!Band->bIsSucceeded)
+			{
+				return false;
+			}
+
+			OutPngData.Append(Band->Chunk);
+			Adler = adler32_combine(Adler, Band->Adler, static_cast<z_off_t>(Band->FilteredRows.Num()));
+		}
+
+		AppendImageTrailer(OutPngData, static_cast<uint32>(Adler));
+		return true;
+	}
+
+	int32 FParallelPngEncoder::GetCompressionLevel(const int32 CompressionQuality)
+	{
+		// 0 means the default of the image write options, otherwise maps 1-100 to the zlib compression level.
+		if (CompressionQuality <= 0)
+		{
+			return Z_DEFAULT_COMPRESSION;
+		}
+
+		return FMath::Clamp(FMath::CeilToInt(CompressionQuality * Z_BEST_COMPRESSION / 100.f), Z_BEST_SPEED, Z_BEST_COMPRESSION);
+	}
+
+	int32 FParallelPngEncoder::GetMaxPendingBands()
+	{
+		return FMath::Max(FPlatformMisc::NumberOfCoresIncludingHyperthreads() * 2, 2);
+	}
+
+	bool FParallelPngEncoder::FPixelFormat::IsIndexed() const
+	{
+		return (ColorType == ParallelPngEncoderInternal::ColorTypeIndexed);
+	}
+
+	int64 FParallelPngEncoder::FPixelFormat::GetNumRowBytes(const int32 Width) const
+	{
+		if (IsIndexed())
+		{
+			return (static_cast<int64>(Width) * BitDepth + 7) / 8;
+		}
+
+		return static_cast<int64>(Width) * BytesPerPixel;
+	}
+
+	FParallelPngEncoder::FParallelPngEncoder(const FIntPoint& InImageSize, const int32 CompressionQuality)
+		: ImageSize(InImageSize)
+		, CompressionLevel(GetCompressionLevel(CompressionQuality))
+		, NumAddedRows(0)
+		, Adler(adler32(0, nullptr, 0))
+	{
+	}
+
+	void FParallelPngEncoder::BeginImage(TArray64<uint8>& OutData) const
+	{
+		AppendImageHeader(OutData, ImageSize, PixelFormat);
+	}
+
+	bool FParallelPngEncoder::AddRows(const FColor* Pixels, const int32 NumRows)
+	{
+		if (Pixels == nullptr || NumRows <= 0 || NumAddedRows + NumRows > ImageSize.Y)
+		{
+			return false;
+		}
+
+		TArray<TSharedRef<FBand, ESPMode::ThreadSafe>> Bands;
+		CreateBands(
+			ImageSize,
+			PixelFormat,
+			Pixels,
+			NumAddedRows,
+			NumRows,
+			(PreviousRow.Num() > 0) ? PreviousRow.GetData() : nullptr,
+			PreviousDictionary,
+			Bands
+		);
+
+		// Keeps what the next rows depend on before the caller reuses the pixels.
+		const FColor* LastRow = Pixels + static_cast<int64>(NumRows - 1) * ImageSize.X;
+		PreviousRow = TArray<FColor>(LastRow, ImageSize.X);
+
+		const TArray64<uint8>& LastFilteredRows = Bands.Last()->FilteredRows;
+		const int64 DictionarySize = FMath::Min<int64>(LastFilteredRows.Num(), ParallelPngEncoderInternal::MaxDictionarySize);
+		PreviousDictionary = TArray<uint8>(LastFilteredRows.GetData() + LastFilteredRows.Num() - DictionarySize, static_cast<int32>(DictionarySize));
+
+		NumAddedRows += NumRows;
+
+		for (const TSharedRef<FBand, ESPMode::ThreadSafe>& Band : Bands)
+		{
+			const int32 Level = CompressionLevel;
+			PendingBands.Add(
+				FPendingBand{
+					Band,
+					Async(
+						EAsyncExecution::ThreadPool,
+						[Band, Level]()
+						{
+							CompressBand(*Band, Level);
+						}
+					)
+				}
+			);
+		}
+
+		return true;
+	}
+
+	bool FParallelPngEncoder::FlushFinishedBands(TArray64<uint8>& OutData, const int32 MaxPendingBands)
+	{
+		int32 NumFlushedBands = 0;
+		bool bIsSucceeded = true;
+		while (PendingBands.IsValidIndex(NumFlushedBands))
+		{
+			FPendingBand& PendingBand = PendingBands[NumFlushedBands];
+			const int32 NumRemainingBands = PendingBands.Num() - NumFlushedBands;
+			if (NumRemainingBands <= MaxPendingBands && !PendingBand.Task.IsReady())
+			{
+				break;
+			}
+
+			PendingBand.Task.Wait();
+			NumFlushedBands++;
+
+			if (!PendingBand.Band->bIsSucceeded)
+			{
+				bIsSucceeded = false;
+				break;
+			}
+
+			OutData.Append(PendingBand.Band->Chunk);
+			Adler = adler32_combine(Adler, PendingBand.Band->Adler, static_cast<z_off_t>(PendingBand.Band->FilteredRows.Num()));
+		}
+
+		PendingBands.RemoveAt(0, NumFlushedBands);
+		return bIsSucceeded;
+	}
+
+	bool FParallelPngEncoder::EndImage(TArray64<uint8>& OutData)
+	{
+		if (NumAddedRows != ImageSize.Y)
+		{
+			return false;
+		}
+
+		if (!FlushFinishedBands(OutData, 0))
+		{
+			return false;
+		}
+
+		AppendImageTrailer(OutData, Adler);
+		return true;
+	}
+
+	FParallelPngEncoder::FPixelFormat FParallelPngEncoder::AnalyzePixels(
+		const FIntPoint& ImageSize,
+		const FColor* Pixels,
+		const EPngColorReduction ColorReduction
+	)
+	{
+		using namespace ParallelPngEncoderInternal;
+
+		FPixelFormat Format;
+		if (ColorReduction == EPngColorReduction::None)
+		{
+			return Format;
+		}
+
+		const int32 Width = ImageSize.X;
+		const int32 RowsPerChunk = GetRowsPerBand(static_cast<int64>(Width) * sizeof(FColor));
+		const int32 NumChunks = FMath::DivideAndRoundUp(ImageSize.Y, RowsPerChunk);
+
+		// Each chunk stops scanning as soon as nothing it could find would change the result.
+		std::atomic<bool> bHasTranslucentPixels(false);
+		std::atomic<bool> bHasTooManyColors(ColorReduction != EPngColorReduction::Palette);
+		TArray<TSet<FColor>> ColorsPerChunk;
+		ColorsPerChunk.SetNum(NumChunks);
+
+		ParallelFor(
+			NumChunks,
+			[&](const int32 ChunkIndex)
+			{
+				const int32 StartRow = ChunkIndex * RowsPerChunk;
+				const int64 NumPixels = static_cast<int64>(FMath::Min(RowsPerChunk, ImageSize.Y - StartRow)) * Width;
+				const FColor* ChunkPixels = Pixels + static_cast<int64>(StartRow) * Width;
+				TSet<FColor>& Colors = ColorsPerChunk[ChunkIndex];
+
+				bool bIsOpaque = true;
+				FColor LastColor = ChunkPixels[0];
+				Colors.Add(LastColor);
+				for (int64 PixelIndex = 0; PixelIndex < NumPixels; PixelIndex++)
+				{
+					const FColor& Color = ChunkPixels[PixelIndex];
+					if (Color.A != 255)
+					{
+						bIsOpaque = false;
+					}
+
+					if (!bHasTooManyColors.load(std::memory_order_relaxed))
+					{
+						if (Color != LastColor)
+						{
+							LastColor = Color;
+							Colors.Add(Color);
+							if (Colors.Num() > MaxPaletteSize)
+							{
+								bHasTooManyColors = true;
+							}
+						}
+					}
+					else if (!bIsOpaque || bHasTranslucentPixels.load(std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+
+				if (!bIsOpaque)
+				{
+					bHasTranslucentPixels = true;
+				}
+			}
+		);
+
+		if (!bHasTooManyColors)
+		{
+			TSet<FColor> Colors;
+			for (const TSet<FColor>& ChunkColors : ColorsPerChunk)
+			{
+				Colors.Append(ChunkColors);
+			}
+
+			if (Colors.Num() <= MaxPaletteSize)
+			{
+				// Sorts the colors so that the same image is always encoded the same way regardless of the order in which the chunks finished.
+				Format.Palette = Colors.Array();
+				Format.Palette.Sort(
+					[](const FColor& Lhs, const FColor& Rhs) -> bool
+					{
+						const bool bIsLhsOpaque = (Lhs.A == 255);
+						const bool bIsRhsOpaque = (Rhs.A == 255);
+						if (bIsLhsOpaque != bIsRhsOpaque)
+						{
+							return bIsRhsOpaque;
+						}
+						return (Lhs.DWColor() < Rhs.DWColor());
+					}
+				);
+
+				for (int32 Index = 0; Index < Format.Palette.Num(); Index++)
+				{
+					Format.PaletteIndices.Add(Format.Palette[Index], static_cast<uint8>(Index));
+					if (Format.Palette[Index].A != 255)
+					{
+						Format.NumTranslucentColors = Index + 1;
+					}
+				}
+
+				Format.ColorType = ColorTypeIndexed;
+				Format.BytesPerPixel = 1;
+				if (Format.Palette.Num() <= 2)
+				{
+					Format.BitDepth = 1;
+				}
+				else if (Format.Palette.Num() <= 4)
+				{
+					Format.BitDepth = 2;
+				}
+				else if (Format.Palette.Num() <= 16)
+				{
+					Format.BitDepth = 4;
+				}
+				return Format;
+			}
+		}
+
+		if (!bHasTranslucentPixels)
+		{
+			Format.ColorType = ColorTypeRgb;
+			Format.BytesPerPixel = 3;
+		}
+
+		return Format;
+	}
+
+	void FParallelPngEncoder::CreateBands(
+		const FIntPoint& ImageSize,
+		const FPixelFormat& Format,
+		const FColor* Pixels,
+		const int32 StartRow,
+		const int32 NumRows,
+		const FColor* PreviousRow,
+		const TArray<uint8>& PreviousDictionary,
+		TArray<TSharedRef<FBand, ESPMode::ThreadSafe>>& OutBands
+	)
+	{
+		const int32 Width = ImageSize.X;
+		const int64 NumFilteredRowBytes = 1 + Format.GetNumRowBytes(Width);
+		const int32 RowsPerBand = ParallelPngEncoderInternal::GetRowsPerBand(NumFilteredRowBytes);
+		const int32 NumBands = FMath::DivideAndRoundUp(NumRows, RowsPerBand);
+
+		OutBands.Reset(NumBands);
+		for (int32 BandIndex = 0; BandIndex < NumBands; BandIndex++)
+		{
+			const int32 BandStartRow = StartRow + BandIndex * RowsPerBand;
+			const int32 BandNumRows = FMath::Min(RowsPerBand, NumRows - BandIndex * RowsPerBand);
+
+			const TSharedRef<FBand, ESPMode::ThreadSafe> Band = MakeShared<FBand, ESPMode::ThreadSafe>();
+			Band->FilteredRows.SetNumUninitialized(BandNumRows * NumFilteredRowBytes);
+			Band->bIsFirstBand = (BandStartRow == 0);
+			Band->bIsLastBand = (BandStartRow + BandNumRows == ImageSize.Y);
+			OutBands.Add(Band);
+		}
+
+		ParallelFor(
+			NumBands,
+			[&](const int32 BandIndex)
+			{
+				const int32 FirstRowIndex = BandIndex * RowsPerBand;
+				const FColor* Rows = Pixels + static_cast<int64>(FirstRowIndex) * Width;
+				const FColor* RowAbove = (FirstRowIndex > 0) ? (Rows - Width) : PreviousRow;
+				const int32 BandNumRows = static_cast<int32>(OutBands[BandIndex]->FilteredRows.Num() / NumFilteredRowBytes);
+				ParallelPngEncoderInternal::FilterRows(Rows, RowAbove, Width, BandNumRows, Format, OutBands[BandIndex]->FilteredRows.GetData());
+			}
+		);
+
+		// Each band refers to the exact data that precedes it, so the bands can be joined into one stream.
+		for (int32 BandIndex = 0; BandIndex < NumBands; BandIndex++)
+		{
+			if (BandIndex == 0)
+			{
+				OutBands[BandIndex]->Dictionary = PreviousDictionary;
+				continue;
+			}
+
+			const TArray64<uint8>& PreviousFilteredRows = OutBands[BandIndex - 1]->FilteredRows;
+			const int64 DictionarySize = FMath::Min<int64>(PreviousFilteredRows.Num(), ParallelPngEncoderInternal::MaxDictionarySize);
+			OutBands[BandIndex]->Dictionary = TArray<uint8>(
+				PreviousFilteredRows.GetData() + PreviousFilteredRows.Num() - DictionarySize,
+				static_cast<int32>(DictionarySize)
+			);
+		}
+	}
+
+	void FParallelPngEncoder::CompressBand(FBand& Band, const int32 CompressionLevel)
+	{
+		using namespace ParallelPngEncoderInternal;
+
+		Band.bIsSucceeded = false;
+
+		z_stream Stream;
+		FMemory::Memzero(Stream);
+
+		// Uses the same window and strategy as libpng, but writes raw deflate data since the zlib header is only needed once.
+		if (deflateInit2(&Stream, CompressionLevel, Z_DEFLATED, -MAX_WBITS, 8, Z_FILTERED) != Z_OK)
+		{
+			return;
+		}
+		ON_SCOPE_EXIT
+		{
+			deflateEnd(&Stream);
+		};
+
+		if (Band.Dictionary.Num() > 0)
+		{
+			if (deflateSetDictionary(&Stream, Band.Dictionary.GetData(), Band.Dictionary.Num()) != Z_OK)
+			{
+				return;
+			}
+		}
+
+		const int64 ZlibHeaderSize = Band.bIsFirstBand ? 2 : 0;
+		const int64 DataOffset = ChunkHeaderSize;
+
+		TArray64<uint8>& Chunk = Band.Chunk;
+		Chunk.SetNumUninitialized(DataOffset + ZlibHeaderSize + deflateBound(&Stream, static_cast<uLong>(Band.FilteredRows.Num())) + 16);
+		FMemory::Memcpy(Chunk.GetData() + 4, "IDAT", 4);
+
+		if (Band.bIsFirstBand)
+		{
+			GetZlibHeader(CompressionLevel, Chunk[DataOffset], Chunk[DataOffset + 1]);
+		}
+
+		// The bands other than the last end with a sync flush so that the next band starts at a byte boundary.
+		const int32 Flush = Band.bIsLastBand ? Z_FINISH : Z_SYNC_FLUSH;
+
+		const uint8* Input = Band.FilteredRows.GetData();
+		int64 RemainingInput = Band.FilteredRows.Num();
+		int64 NumWrittenBytes = DataOffset + ZlibHeaderSize;
+		while (true)
+		{
+			if (Stream.avail_in == 0 && RemainingInput > 0)
+			{
+				Stream.next_in = const_cast<Bytef*>(Input);
+				Stream.avail_in = static_cast<uInt>(FMath::Min<int64>(RemainingInput, MAX_uint32));
+				Input += Stream.avail_in;
+				RemainingInput -= Stream.avail_in;
+			}
+
+			if (NumWrittenBytes == Chunk.Num())
+			{
+				Chunk.SetNumUninitialized(Chunk.Num() + FMath::Max<int64>(Chunk.Num() / 2, 64));
+			}
+			Stream.next_out = Chunk.GetData() + NumWrittenBytes;
+			Stream.avail_out = static_cast<uInt>(FMath::Min<int64>(Chunk.Num() - NumWrittenBytes, MAX_uint32));
+
+			const uInt AvailableOutput = Stream.avail_out;
+			const int32 Result = deflate(&Stream, (RemainingInput > 0) ? Z_NO_FLUSH : Flush);
+			NumWrittenBytes += AvailableOutput - Stream.avail_out;
+
+			if (Result == Z_STREAM_END)
+			{
+				break;
+			}
+			if (Result != Z_OK && Result != Z_BUF_ERROR)
+			{
+				return;
+			}
+			if (Flush == Z_SYNC_FLUSH && RemainingInput == 0 && Stream.avail_in == 0 && Stream.avail_out > 0)
+			{
+				break;
+			}
+		}
+
+		const int64 DataSize = NumWrittenBytes - DataOffset;
+		if (DataSize > MAX_int32)
+		{
+			return;
+		}
+
+		Chunk.SetNumUninitialized(NumWrittenBytes + ChunkFooterSize, false);
+		FinishChunk(Chunk.GetData(), static_cast<uint32>(DataSize));
+
+		Band.Adler = static_cast<uint32>(CalculateChecksum(adler32(0, nullptr, 0), Band.FilteredRows.GetData(), Band.FilteredRows.Num(), adler32));
+		Band.bIsSucceeded = true;
+	}
+
+	void FParallelPngEncoder::AppendImageHeader(TArray64<uint8>& OutData, const FIntPoint& ImageSize, const FPixelFormat& Format)
+	{
+		static const uint8 Signature[] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+		OutData.Append(Signature, UE_ARRAY_COUNT(Signature));
+
+		// Without interlacing.
+		uint8 Header[13];
+		ParallelPngEncoderInternal::WriteUint32(Header, static_cast<uint32>(ImageSize.X));
+		ParallelPngEncoderInternal::WriteUint32(Header + 4, static_cast<uint32>(ImageSize.Y));
+		Header[8] = Format.BitDepth;
+		Header[9] = Format.ColorType;
+		Header[10] = 0;
+		Header[11] = 0;
+		Header[12] = 0;
+		ParallelPngEncoderInternal::AppendChunk(OutData, "IHDR", Header, sizeof(Header));
+
+		if (!Format.IsIndexed())
+		{
+			return;
+		}
+
+		TArray<uint8> Palette;
+		Palette.Reserve(Format.Palette.Num() * 3);
+		for (const FColor& Color : Format.Palette)
+		{
+			Palette.Add(Color.R);
+			Palette.Add(Color.G);
+			Palette.Add(Color.B);
+		}
+		ParallelPngEncoderInternal::AppendChunk(OutData, "PLTE", Palette.GetData(), Palette.Num());
+
+		// The alpha of the colors after the translucent ones is treated as fully opaque, so only the beginning needs to be written.
+		if (Format.NumTranslucentColors > 0)
+		{
+			TArray<uint8> Alphas;
+			Alphas.Reserve(Format.NumTranslucentColors);
+			for (int32 Index = 0; Index < Format.NumTranslucentColors; Index++)
+			{
+				Alphas.Add(Format.Palette[Index].A);
+			}
+			ParallelPngEncoderInternal::AppendChunk(OutData, "tRNS", Alphas.GetData(), Alphas.Num());
+		}
+	}
+
+	void FParallelPngEncoder::AppendImageTrailer(TArray64<uint8>& OutData, const uint32 Adler)
+	{
+		// The checksum that ends the zlib stream is written in its own IDAT chunk, since the IDAT chunks are concatenated when decoding.
+		uint8 Checksum[4];
+		ParallelPngEncoderInternal::WriteUint32(Checksum, Adler);
+		ParallelPngEncoderInternal::AppendChunk(OutData, "IDAT", Checksum, sizeof(Checksum));
+		ParallelPngEncoderInternal::AppendChunk(OutData, "IEND", nullptr, 0);
+	}
+}
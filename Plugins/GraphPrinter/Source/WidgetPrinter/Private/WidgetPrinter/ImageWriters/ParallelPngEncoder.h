@@ -0,0 +1,164 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "WidgetPrinter/Types/PngColorReduction.h"
+
+namespace GraphPrinter
+{
+	/**
+	 * A class that encodes png images using multiple threads.
+	 * The rows are split into bands, and each band is filtered and compressed independently as a raw deflate stream
+	 * ending with a sync flush, using the end of the previous band as the dictionary.
+	 * The compressed bands are joined in order into a single zlib stream of IDAT chunks.
+	 * When encoding the entire image, the pixels can be analyzed first to write them as RGB or with an indexed palette.
+	 */
+	class FParallelPngEncoder
+	{
+	public:
+		// Encodes the entire image into a png in memory.
+		// It can also be called from worker threads, as the calling thread takes part in the encoding.
+		// The color type is reduced only if all pixels can be written without changing their colors.
+		static bool Encode(
+			const FIntPoint& ImageSize,
+			const FColor* Pixels,
+			const int32 CompressionQuality,
+			TArray64<uint8>& OutPngData,
+			const EPngColorReduction ColorReduction = EPngColorReduction::None
+		);
+
+		// Converts the compression quality of the image write options to the zlib compression level.
+		static int32 GetCompressionLevel(const int32 CompressionQuality);
+
+		// Returns the number of bands that can be compressed at the same time without holding too many of them in memory.
+		static int32 GetMaxPendingBands();
+
+	public:
+		// The color type and layout of the pixels written to the png.
+		struct FPixelFormat
+		{
+			// The color type and bit depth written in the header chunk.
+			uint8 ColorType = 6;
+			uint8 BitDepth = 8;
+
+			// The number of bytes that the filters treat as one pixel.
+			int32 BytesPerPixel = 4;
+
+			// The colors of the indexed palette with the colors that are not fully opaque at the beginning.
+			TArray<FColor> Palette;
+
+			// The index of each color in the palette.
+			TMap<FColor, uint8> PaletteIndices;
+
+			// The number of colors in the palette that are not fully opaque.
+			int32 NumTranslucentColors = 0;
+
+			// Returns whether the pixels are written as the indices of the palette.
+			bool IsIndexed() const;
+
+			// Returns the number of bytes of a row without the filter type.
+			int64 GetNumRowBytes(const int32 Width) const;
+		};
+
+		// Constructor.
+		// The streamed rows are always written as 8-bit RGBA, since all colors are not known in advance.
+		FParallelPngEncoder(const FIntPoint& InImageSize, const int32 CompressionQuality);
+
+		// Appends the png signature and the header chunk.
+		void BeginImage(TArray64<uint8>& OutData) const;
+
+		// Filters the rows and starts compressing them on worker threads.
+		// The pixels are not referenced after returning, so the caller can reuse them.
+		bool AddRows(const FColor* Pixels, const int32 NumRows);
+
+		// Appends the bands whose compression has finished in order.
+		// Waits for the oldest bands until at most the specified number of bands are being compressed.
+		bool FlushFinishedBands(TArray64<uint8>& OutData, const int32 MaxPendingBands);
+
+		// Waits for all bands to be compressed and appends them and the end of the image.
+		// Returns false if not all rows of the image have been added.
+		bool EndImage(TArray64<uint8>& OutData);
+
+	private:
+		// A range of rows that is compressed independently.
+		struct FBand
+		{
+			// The filtered rows with the filter type at the beginning of each row.
+			TArray64<uint8> FilteredRows;
+
+			// The end of the filtered rows of the previous band.
+			TArray<uint8> Dictionary;
+
+			// The IDAT chunk that contains the compressed rows.
+			TArray64<uint8> Chunk;
+
+			// The adler-32 checksum of the filtered rows.
+			uint32 Adler = 0;
+
+			// Whether this band contains the first or last row of the image.
+			bool bIsFirstBand = false;
+			bool bIsLastBand = false;
+
+			// Whether the compression has succeeded.
+			bool bIsSucceeded = false;
+		};
+
+		// A band whose compression has been started on a worker thread.
+		struct FPendingBand
+		{
+			TSharedRef<FBand, ESPMode::ThreadSafe> Band;
+			TFuture<void> Task;
+		};
+
+		// Analyzes all pixels in parallel and returns the smallest format that can represent them without loss.
+		static FPixelFormat AnalyzePixels(const FIntPoint& ImageSize, const FColor* Pixels, const EPngColorReduction ColorReduction);
+
+		// Filters the rows in parallel on the calling thread and splits them into bands.
+		static void CreateBands(
+			const FIntPoint& ImageSize,
+			const FPixelFormat& Format,
+			const FColor* Pixels,
+			const int32 StartRow,
+			const int32 NumRows,
+			const FColor* PreviousRow,
+			const TArray<uint8>& PreviousDictionary,
+			TArray<TSharedRef<FBand, ESPMode::ThreadSafe>>& OutBands
+		);
+
+		// Compresses the band into an IDAT chunk.
+		static void CompressBand(FBand& Band, const int32 CompressionLevel);
+
+		// Appends the png signature, the header chunk and the palette chunks if indexed.
+		static void AppendImageHeader(TArray64<uint8>& OutData, const FIntPoint& ImageSize, const FPixelFormat& Format);
+
+		// Appends the checksum that ends the zlib stream and the end chunk.
+		static void AppendImageTrailer(TArray64<uint8>& OutData, const uint32 Adler);
+
+	private:
+		// The size of the image being encoded.
+		FIntPoint ImageSize;
+
+		// The format of the pixels being encoded.
+		FPixelFormat PixelFormat;
+
+		// The zlib compression level.
+		int32 CompressionLevel;
+
+		// The number of rows already added.
+		int32 NumAddedRows;
+
+		// The last row already added that is used to filter the next row.
+		TArray<FColor> PreviousRow;
+
+		// The end of the filtered rows already added that is used as the dictionary of the next band.
+		TArray<uint8> PreviousDictionary;
+
+		// The bands being compressed in order of the rows.
+		TArray<FPendingBand> PendingBands;
+
+		// The adler-32 checksum of the filtered rows of the bands already flushed.
+		uint32 Adler;
+	};
+}
@@ -0,0 +1,23 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#include "WidgetPrinter/ImageWriters/StreamingImageWriter.h"
+#include "WidgetPrinter/ImageWriters/StreamingPngImageWriter.h"
+#include "ImageWriteTypes.h"
+
+namespace GraphPrinter
+{
+	TSharedPtr<IStreamingImageWriter> IStreamingImageWriter::Create(const EDesiredImageFormat ImageFormat)
+	{
+		if (ImageFormat == EDesiredImageFormat::PNG)
+		{
+			return MakeShared<FStreamingPngImageWriter>();
+		}
+
+		return nullptr;
+	}
+
+	bool IStreamingImageWriter::IsSupportedFormat(const EDesiredImageFormat ImageFormat)
+	{
+		return (ImageFormat == EDesiredImageFormat::PNG);
+	}
+}
@@ -0,0 +1,162 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#include "WidgetPrinter/ImageWriters/StreamingPngImageWriter.h"
+#include "GraphPrinterGlobals/GraphPrinterGlobals.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Serialization/Archive.h"
+
+namespace GraphPrinter
+{
+	FStreamingPngImageWriter::FStreamingPngImageWriter()
+		: bOverwriteFile(false)
+	{
+	}
+
+	FStreamingPngImageWriter::~FStreamingPngImageWriter()
+	{
+		if (FileWriter.IsValid())
+		{
+			Abort();
+		}
+	}
+
+	bool FStreamingPngImageWriter::Open(
+		const FString& InFilename,
+		const FIntPoint& InImageSize,
+		const int32 CompressionQuality,
+		const bool bInOverwriteFile,
+		const TArray<uint8>& EncodedMetadata
+	)
+	{
+		check(!FileWriter.IsValid());
+		
+		if (InImageSize.X <= 0 || InImageSize.Y <= 0)
+		{
+			return false;
+		}
+		
+		Filename = InFilename;
+		bOverwriteFile = bInOverwriteFile;
+
+		if (!bOverwriteFile && IFileManager::Get().FileExists(*Filename))
+		{
+			UE_LOG(LogGraphPrinter, Error, TEXT("%s already exists and cannot be overwritten."), *Filename);
+			return false;
+		}
+
+		TempFilename = FPaths::CreateTempFilename(*FPaths::GetPath(Filename), TEXT("GraphPrinter"), TEXT(".tmp"));
+		FileWriter = TUniquePtr<FArchive>(IFileManager::Get().CreateFileWriter(*TempFilename));
+		if (!FileWriter.IsValid())
+		{
+			UE_LOG(LogGraphPrinter, Error, TEXT("Failed to create %s."), *TempFilename);
+			return false;
+		}
+
+		Encoder = MakeUnique<FParallelPngEncoder>(InImageSize, CompressionQuality);
+		Encoder->BeginImage(EncodedData);
+
+		// The text chunks are placed between the header and the first IDAT chunk,
+		// so that they can be read without reading the image data and the file never needs to be rewritten.
+		EncodedData.Append(EncodedMetadata);
+
+		return WriteEncodedData();
+	}
+
+	bool FStreamingPngImageWriter::WriteRows(const FColor* Pixels, const int32 NumRows)
+	{
+		if (!FileWriter.IsValid() || !Encoder.IsValid())
+		{
+			return false;
+		}
+
+		if (!Encoder->AddRows(Pixels, NumRows))
+		{
+			UE_LOG(LogGraphPrinter, Error, TEXT("Failed to add rows to %s."), *Filename);
+			Abort();
+			return false;
+		}
+
+		// Writes the rows that have already been compressed, and waits only if too many rows are waiting to be compressed.
+		if (!Encoder->FlushFinishedBands(EncodedData, FParallelPngEncoder::GetMaxPendingBands()))
+		{
+			UE_LOG(LogGraphPrinter, Error, TEXT("Failed to compress the rows of %s."), *Filename);
+			Abort();
+			return false;
+		}
+
+		return WriteEncodedData();
+	}
+
+	bool FStreamingPngImageWriter::Close()
+	{
+		if (!FileWriter.IsValid() || !Encoder.IsValid())
+		{
+			return false;
+		}
+
+		if (!Encoder->EndImage(EncodedData))
+		{
+			UE_LOG(LogGraphPrinter, Error, TEXT("Failed to finish writing %s."), *Filename);
+			Abort();
+			return false;
+		}
+
+		if (!WriteEncodedData())
+		{
+			return false;
+		}
+		Encoder.Reset();
+
+		const bool bIsClosed = FileWriter->Close();
+		FileWriter.Reset();
+		if (!bIsClosed)
+		{
+			IFileManager::Get().Delete(*TempFilename, false, true);
+			return false;
+		}
+
+		if (!IFileManager::Get().Move(*Filename, *TempFilename, bOverwriteFile))
+		{
+			UE_LOG(LogGraphPrinter, Error, TEXT("Failed to move %s to %s."), *TempFilename, *Filename);
+			IFileManager::Get().Delete(*TempFilename, false, true);
+			return false;
+		}
+
+		return true;
+	}
+
+	bool FStreamingPngImageWriter::WriteEncodedData()
+	{
+		if (EncodedData.Num() == 0)
+		{
+			return true;
+		}
+
+		FileWriter->Serialize(EncodedData.GetData(), EncodedData.Num());
+		EncodedData.Reset();
+		
+		if (FileWriter->IsError())
+		{
+			UE_LOG(LogGraphPrinter, Error, TEXT("Failed to write to %s."), *Filename);
+			Abort();
+			return false;
+		}
+
+		return true;
+	}
+
+	void FStreamingPngImageWriter::Abort()
+	{
+		// The bands being compressed hold their own data, so they can be left to finish on the worker threads.
+		Encoder.Reset();
+		EncodedData.Empty();
+		
+		if (FileWriter.IsValid())
+		{
+			FileWriter->Close();
+			FileWriter.Reset();
+			IFileManager::Get().Delete(*TempFilename, false, true);
+		}
+	}
+}
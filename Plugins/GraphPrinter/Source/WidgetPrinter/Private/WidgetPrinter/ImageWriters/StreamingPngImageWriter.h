@@ -0,0 +1,64 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WidgetPrinter/ImageWriters/StreamingImageWriter.h"
+#include "WidgetPrinter/ImageWriters/ParallelPngEncoder.h"
+
+class FArchive;
+
+namespace GraphPrinter
+{
+	/**
+	 * A class that writes png files row by row while compressing the rows on worker threads.
+	 */
+	class FStreamingPngImageWriter : public IStreamingImageWriter
+	{
+	public:
+		// Constructor.
+		FStreamingPngImageWriter();
+
+		// Destructor.
+		virtual ~FStreamingPngImageWriter() override;
+		
+		// IStreamingImageWriter interface.
+		virtual bool Open(
+			const FString& InFilename,
+			const FIntPoint& InImageSize,
+			const int32 CompressionQuality,
+			const bool bInOverwriteFile,
+			const TArray<uint8>& EncodedMetadata
+		) override;
+		virtual bool WriteRows(const FColor* Pixels, const int32 NumRows) override;
+		virtual bool Close() override;
+		// End of IStreamingImageWriter interface.
+
+	protected:
+		// Writes the encoded data to the file and empties it.
+		bool WriteEncodedData();
+		
+		// Discards the image file being written.
+		void Abort();
+
+	protected:
+		// The file path of the image file to write.
+		FString Filename;
+
+		// The file path of the temporary file that is moved to the image file when all rows have been written.
+		// Writing to a separate file keeps the existing image file if the writing fails.
+		FString TempFilename;
+
+		// Whether to replace the image file if it already exists.
+		bool bOverwriteFile;
+
+		// The archive of the image file being written.
+		TUniquePtr<FArchive> FileWriter;
+
+		// The encoder that compresses the rows on worker threads.
+		TUniquePtr<FParallelPngEncoder> Encoder;
+
+		// The encoded data that has not been written to the file yet.
+		TArray64<uint8> EncodedData;
+	};
+}
@@ -0,0 +1,367 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#include "WidgetPrinter/PrintJobQueueImpl.h"
+#include "WidgetPrinter/IWidgetPrinterRegistry.h"
+#include "WidgetPrinter/Utilities/WidgetPrinterSettings.h"
+#include "GraphPrinterGlobals/GraphPrinterGlobals.h"
+#include "GraphPrinterGlobals/Utilities/GraphPrinterSettings.h"
+
+namespace GraphPrinter
+{
+	FPrintJobProgress FPrintJobQueueImpl::FPrintJob::GetProgress() const
+	{
+		FPrintJobProgress Progress;
+		Progress.JobId = JobId;
+		Progress.State = State;
+		Progress.NumFinishedWidgets = NumFinishedWidgets;
+		Progress.NumSucceededWidgets = NumSucceededWidgets;
+		Progress.NumWidgets = OptionsList.Num();
+		return Progress;
+	}
+
+	bool FPrintJobQueueImpl::FPrintJob::HasWidgetsToStart() const
+	{
+		return OptionsList.IsValidIndex(NextIndex);
+	}
+
+	bool FPrintJobQueueImpl::FPrintJob::CanMerge(const UPrintWidgetOptions* Options, const TSharedPtr<SWidget>& InWidgetToPrint) const
+	{
+		if (bIsBatch || bIsCancelRequested || OptionsList.Num() != 1)
+		{
+			return false;
+		}
+
+		// The search target is usually the focused widget, which differs between the requests for the same editor.
+		const UPrintWidgetOptions* JobOptions = OptionsList[0].Get();
+		return (
+			IsValid(JobOptions) &&
+			InWidgetToPrint.IsValid() &&
+			WidgetToPrint.Pin() == InWidgetToPrint &&
+			JobOptions->GetClass() == Options->GetClass() &&
+			JobOptions->PrintScope == Options->PrintScope &&
+			JobOptions->ExportMethod == Options->ExportMethod
+		);
+	}
+
+	FPrintJobQueueImpl::FPrintJobQueueImpl()
+		: NextJobId(0)
+		, NumInFlight(0)
+	{
+#if UE_5_00_OR_LATER
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+#else
+		TickerHandle = FTicker::GetCoreTicker().AddTicker(
+#endif
+			FTickerDelegate::CreateRaw(this, &FPrintJobQueueImpl::HandleOnTick)
+		);
+	}
+
+	FPrintJobQueueImpl::~FPrintJobQueueImpl()
+	{
+#if UE_5_00_OR_LATER
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+#else
+		FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+#endif
+
+		Jobs.Reset();
+	}
+
+	int32 FPrintJobQueueImpl::Submit(UPrintWidgetOptions* Options, const EPrintJobPriority Priority, const FOnPrintJobProgress& OnProgress)
+	{
+		check(IsValid(Options));
+
+		// Pressing the shortcut again during a slow print would otherwise start a competing print of the same widget.
+		const TSharedPtr<SWidget> WidgetToPrint = FindWidgetToPrint(Options);
+		for (const TSharedRef<FPrintJob>& Job : Jobs)
+		{
+			if (!Job->CanMerge(Options, WidgetToPrint))
+			{
+				continue;
+			}
+
+			if (Job->State == EPrintJobState::Queued && Priority > Job->Priority)
+			{
+				Job->Priority = Priority;
+			}
+			if (OnProgress.IsBound())
+			{
+				Job->OnProgressList.Add(OnProgress);
+				OnProgress.Execute(Job->GetProgress());
+			}
+
+			return Job->JobId;
+		}
+
+		const TSharedRef<FPrintJob> Job = AddJob(Priority, OnProgress);
+		Job->OptionsList.Emplace(Options);
+		Job->WidgetToPrint = WidgetToPrint;
+		NotifyProgress(*Job);
+
+		return Job->JobId;
+	}
+
+	int32 FPrintJobQueueImpl::SubmitBatch(const TArray<UPrintWidgetOptions*>& OptionsList, const EPrintJobPriority Priority, const FOnPrintJobProgress& OnProgress)
+	{
+		const TSharedRef<FPrintJob> Job = AddJob(Priority, OnProgress);
+		Job->bIsBatch = true;
+		for (UPrintWidgetOptions* Options : OptionsList)
+		{
+			if (!IsValid(Options))
+			{
+				continue;
+			}
+
+			// Without waiting for the GPU, the next widget can be drawn while the previous one is being read back.
+			// The options are copied so that the caller's options are not changed by this batch.
+			UPrintWidgetOptions* BatchOptions = Options->Duplicate(Options->GetClass());
+			if (!IsValid(BatchOptions))
+			{
+				continue;
+			}
+			BatchOptions->bUseAsyncReadback = true;
+			Job->OptionsList.Emplace(BatchOptions);
+		}
+		NotifyProgress(*Job);
+		CompleteJobIfDone(Job);
+
+		return Job->JobId;
+	}
+
+	int32 FPrintJobQueueImpl::ExecuteImmediately(UPrintWidgetOptions* Options, const TFunctionRef<bool()>& Execute)
+	{
+		check(IsValid(Options));
+
+		// Since the caller is waiting for the result, it is run without being added to the queue.
+		FPrintJob Job;
+		Job.JobId = NextJobId++;
+		Job.Priority = EPrintJobPriority::Interactive;
+		Job.State = EPrintJobState::Running;
+		Job.OptionsList.Emplace(Options);
+		NotifyProgress(Job);
+
+		const bool bIsSucceeded = Execute();
+
+		Job.NumFinishedWidgets = 1;
+		Job.NumSucceededWidgets = (bIsSucceeded ? 1 : 0);
+		Job.State = EPrintJobState::Finished;
+		NotifyProgress(Job);
+
+		return Job.JobId;
+	}
+
+	bool FPrintJobQueueImpl::Cancel(const int32 JobId)
+	{
+		const TSharedPtr<FPrintJob> Job = FindJob(JobId);
+		if (!Job.IsValid() || Job->bIsCancelRequested)
+		{
+			return false;
+		}
+
+		// The widgets being printed cannot be stopped in the middle of the readback or the file writing, so waits for them.
+		Job->bIsCancelRequested = true;
+		Job->NextIndex = Job->OptionsList.Num();
+		CompleteJobIfDone(Job.ToSharedRef());
+
+		return true;
+	}
+
+	TOptional<FPrintJobProgress> FPrintJobQueueImpl::GetProgress(const int32 JobId) const
+	{
+		const TSharedPtr<FPrintJob> Job = FindJob(JobId);
+		if (!Job.IsValid())
+		{
+			return {};
+		}
+
+		return Job->GetProgress();
+	}
+
+	FOnAnyPrintJobProgress& FPrintJobQueueImpl::OnAnyJobProgress()
+	{
+		return OnAnyJobProgressEvent;
+	}
+
+	TSharedRef<FPrintJobQueueImpl::FPrintJob> FPrintJobQueueImpl::AddJob(const EPrintJobPriority Priority, const FOnPrintJobProgress& OnProgress)
+	{
+		const TSharedRef<FPrintJob> Job = MakeShared<FPrintJob>();
+		Job->JobId = NextJobId++;
+		Job->Priority = Priority;
+		if (OnProgress.IsBound())
+		{
+			Job->OnProgressList.Add(OnProgress);
+		}
+		Jobs.Add(Job);
+
+		return Job;
+	}
+
+	TSharedPtr<FPrintJobQueueImpl::FPrintJob> FPrintJobQueueImpl::FindJob(const int32 JobId) const
+	{
+		for (const TSharedRef<FPrintJob>& Job : Jobs)
+		{
+			if (Job->JobId == JobId)
+			{
+				return Job;
+			}
+		}
+
+		return nullptr;
+	}
+
+	TSharedPtr<SWidget> FPrintJobQueueImpl::FindWidgetToPrint(UPrintWidgetOptions* Options) const
+	{
+		UWidgetPrinter* WidgetPrinter = IWidgetPrinterRegistry::Get().FindAvailableWidgetPrinter(Options);
+		if (!IsValid(WidgetPrinter))
+		{
+			return nullptr;
+		}
+
+		return WidgetPrinter->FindWidgetToPrint(Options);
+	}
+
+	TSharedPtr<FPrintJobQueueImpl::FPrintJob> FPrintJobQueueImpl::FindJobToStart() const
+	{
+		const auto& Settings = GetSettings<UWidgetPrinterSettings>();
+
+		// The jobs are in order of submission, so the first one with the highest priority is the oldest of them.
+		TSharedPtr<FPrintJob> JobToStart = nullptr;
+		for (const TSharedRef<FPrintJob>& Job : Jobs)
+		{
+			if (!Job->HasWidgetsToStart())
+			{
+				continue;
+			}
+
+			if (!JobToStart.IsValid() || Job->Priority > JobToStart->Priority)
+			{
+				JobToStart = Job;
+			}
+		}
+		if (!JobToStart.IsValid())
+		{
+			return nullptr;
+		}
+
+		// Since the user is waiting for the interactive job, it is started without waiting for the widgets of the batch jobs.
+		if (JobToStart->Priority == EPrintJobPriority::Interactive)
+		{
+			return JobToStart;
+		}
+
+		return (NumInFlight < Settings.MaxConcurrentBatchPrints) ? JobToStart : nullptr;
+	}
+
+	void FPrintJobQueueImpl::StartNextWidget(const TSharedRef<FPrintJob>& Job)
+	{
+		UPrintWidgetOptions* Options = Job->OptionsList[Job->NextIndex].Get();
+		Job->NextIndex++;
+
+		if (Job->State == EPrintJobState::Queued)
+		{
+			Job->State = EPrintJobState::Running;
+			NotifyProgress(*Job);
+		}
+
+		UWidgetPrinter* WidgetPrinter = IWidgetPrinterRegistry::Get().FindAvailableWidgetPrinter(Options);
+		if (!IsValid(WidgetPrinter))
+		{
+			UE_LOG(LogGraphPrinter, Warning, TEXT("No printer was found that could print the widget at index %d of job %d."), Job->NextIndex - 1, Job->JobId);
+			Job->NumFinishedWidgets++;
+			NotifyProgress(*Job);
+			CompleteJobIfDone(Job);
+			return;
+		}
+
+		// The printing may be finished before PrintWidget returns.
+		// If the queue is unregistered while printing, the printers finished afterwards are not notified to it.
+		Job->NumInFlight++;
+		NumInFlight++;
+		WidgetPrinter->PrintWidget(
+			Options,
+			UWidgetPrinter::FOnPrintFinished::CreateSP(this, &FPrintJobQueueImpl::HandleOnWidgetPrintFinished, Job->JobId)
+		);
+	}
+
+	void FPrintJobQueueImpl::HandleOnWidgetPrintFinished(const bool bIsSucceeded, const int32 JobId)
+	{
+		NumInFlight--;
+
+		const TSharedPtr<FPrintJob> Job = FindJob(JobId);
+		if (!Job.IsValid())
+		{
+			return;
+		}
+
+		Job->NumInFlight--;
+		Job->NumFinishedWidgets++;
+		if (bIsSucceeded)
+		{
+			Job->NumSucceededWidgets++;
+		}
+		NotifyProgress(*Job);
+		CompleteJobIfDone(Job.ToSharedRef());
+	}
+
+	void FPrintJobQueueImpl::CompleteJobIfDone(const TSharedRef<FPrintJob>& Job)
+	{
+		if (Job->HasWidgetsToStart() || Job->NumInFlight > 0)
+		{
+			return;
+		}
+
+		// Removes the job first so that a new request made from the callbacks is not merged into it.
+		Jobs.Remove(Job);
+
+		Job->State = (Job->bIsCancelRequested ? EPrintJobState::Cancelled : EPrintJobState::Finished);
+		NotifyProgress(*Job);
+	}
+
+	void FPrintJobQueueImpl::NotifyProgress(const FPrintJob& Job)
+	{
+		const FPrintJobProgress Progress = Job.GetProgress();
+
+		// Copies the callbacks since they may submit new requests that are merged into the job.
+		const TArray<FOnPrintJobProgress> OnProgressList = Job.OnProgressList;
+		for (const FOnPrintJobProgress& OnProgress : OnProgressList)
+		{
+			OnProgress.ExecuteIfBound(Progress);
+		}
+		OnAnyJobProgressEvent.Broadcast(Progress);
+	}
+
+	bool FPrintJobQueueImpl::HandleOnTick(float DeltaTime)
+	{
+		// Starts at most one widget per frame so that the drawing on the game thread does not freeze the editor.
+		const TSharedPtr<FPrintJob> Job = FindJobToStart();
+		if (Job.IsValid())
+		{
+			StartNextWidget(Job.ToSharedRef());
+		}
+
+		return true;
+	}
+
+	namespace PrintJobQueue
+	{
+		// Since the printers in flight only hold weak references to the queue, it is held by a shared pointer.
+		static TSharedPtr<FPrintJobQueueImpl> Instance;
+	}
+
+	void IPrintJobQueue::Register()
+	{
+		PrintJobQueue::Instance = MakeShared<FPrintJobQueueImpl>();
+	}
+
+	void IPrintJobQueue::Unregister()
+	{
+		PrintJobQueue::Instance.Reset();
+	}
+
+	IPrintJobQueue& IPrintJobQueue::Get()
+	{
+		// Don't call before Register is called or after Unregister is called.
+		check(PrintJobQueue::Instance.IsValid());
+		return *PrintJobQueue::Instance.Get();
+	}
+}
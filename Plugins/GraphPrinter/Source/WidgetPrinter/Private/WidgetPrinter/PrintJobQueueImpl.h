@@ -0,0 +1,132 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WidgetPrinter/IPrintJobQueue.h"
+#include "WidgetPrinter/Types/PrintWidgetOptions.h"
+#include "GraphPrinterGlobals/GraphPrinterGlobals.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Containers/Ticker.h"
+
+namespace GraphPrinter
+{
+	class FPrintJobQueueImpl : public IPrintJobQueue, public TSharedFromThis<FPrintJobQueueImpl>
+	{
+	public:
+		// Constructor.
+		FPrintJobQueueImpl();
+
+		// Destructor.
+		virtual ~FPrintJobQueueImpl() override;
+
+		// IPrintJobQueue interface.
+		virtual int32 Submit(UPrintWidgetOptions* Options, const EPrintJobPriority Priority, const FOnPrintJobProgress& OnProgress) override;
+		virtual int32 SubmitBatch(const TArray<UPrintWidgetOptions*>& OptionsList, const EPrintJobPriority Priority, const FOnPrintJobProgress& OnProgress) override;
+		virtual int32 ExecuteImmediately(UPrintWidgetOptions* Options, const TFunctionRef<bool()>& Execute) override;
+		virtual bool Cancel(const int32 JobId) override;
+		virtual TOptional<FPrintJobProgress> GetProgress(const int32 JobId) const override;
+		virtual FOnAnyPrintJobProgress& OnAnyJobProgress() override;
+		// End of IPrintJobQueue interface.
+
+	protected:
+		// Returns the widget that the printer found for the request draws, or nullptr if no printer can print it.
+		virtual TSharedPtr<SWidget> FindWidgetToPrint(UPrintWidgetOptions* Options) const;
+
+	private:
+		// A request to print one or more widgets.
+		struct FPrintJob
+		{
+		public:
+			// Returns the progress notified to the callbacks.
+			FPrintJobProgress GetProgress() const;
+
+			// Returns whether there are widgets that have not been started.
+			bool HasWidgetsToStart() const;
+
+			// Returns whether the request to print the widget can be merged into this job.
+			bool CanMerge(const UPrintWidgetOptions* Options, const TSharedPtr<SWidget>& InWidgetToPrint) const;
+
+		public:
+			// The id of this job.
+			int32 JobId = INDEX_NONE;
+
+			// The priority of this job.
+			EPrintJobPriority Priority = EPrintJobPriority::Interactive;
+
+			// The state of this job.
+			EPrintJobState State = EPrintJobState::Queued;
+
+			// The options of the widgets to print.
+			TArray<TStrongObjectPtr<UPrintWidgetOptions>> OptionsList;
+
+			// The widget found from the search target of the request, which is compared when merging the requests.
+			TWeakPtr<SWidget> WidgetToPrint;
+
+			// Whether this job was submitted as a batch and is not merged with other requests.
+			bool bIsBatch = false;
+
+			// Whether the cancellation was requested while some widgets were being printed.
+			bool bIsCancelRequested = false;
+
+			// The index of the option to print next.
+			int32 NextIndex = 0;
+
+			// The number of widgets whose printing has started but not finished.
+			int32 NumInFlight = 0;
+
+			// The number of widgets whose printing has been finished.
+			int32 NumFinishedWidgets = 0;
+
+			// The number of widgets that have been printed successfully.
+			int32 NumSucceededWidgets = 0;
+
+			// The events called when the progress of this job changes.
+			TArray<FOnPrintJobProgress> OnProgressList;
+		};
+
+		// Adds a new job to the queue.
+		TSharedRef<FPrintJob> AddJob(const EPrintJobPriority Priority, const FOnPrintJobProgress& OnProgress);
+
+		// Returns the job with the specified id that has not been completed.
+		TSharedPtr<FPrintJob> FindJob(const int32 JobId) const;
+
+		// Returns the job whose widget should be started next, or nullptr if no widget can be started now.
+		TSharedPtr<FPrintJob> FindJobToStart() const;
+
+		// Starts printing the next widget of the job.
+		void StartNextWidget(const TSharedRef<FPrintJob>& Job);
+
+		// Called when the printing of one widget of the job is finished.
+		void HandleOnWidgetPrintFinished(const bool bIsSucceeded, const int32 JobId);
+
+		// Completes the job if it has no widget to start and no widget being printed.
+		void CompleteJobIfDone(const TSharedRef<FPrintJob>& Job);
+
+		// Notifies the progress of the job to its callbacks and the observers of all jobs.
+		void NotifyProgress(const FPrintJob& Job);
+
+		// Called every frame to start the widgets of the queued jobs.
+		bool HandleOnTick(float DeltaTime);
+
+	private:
+		// The jobs that have not been completed in order of submission.
+		TArray<TSharedRef<FPrintJob>> Jobs;
+
+		// The id given to the next submitted job.
+		int32 NextJobId;
+
+		// The number of widgets whose printing has started but not finished in all jobs.
+		int32 NumInFlight;
+
+		// The event called when the progress of any job changes.
+		FOnAnyPrintJobProgress OnAnyJobProgressEvent;
+
+		// The handle of the ticker that starts the widgets.
+#if UE_5_00_OR_LATER
+		FTSTicker::FDelegateHandle TickerHandle;
+#else
+		FDelegateHandle TickerHandle;
+#endif
+	};
+}
@@ -0,0 +1,145 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#include "WidgetPrinter/Rendering/AsyncRenderTargetReadback.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "TextureResource.h"
+#include "RenderingThread.h"
+#if UE_5_01_OR_LATER
+#include "RHIGPUReadback.h"
+#endif
+
+namespace GraphPrinter
+{
+	bool FAsyncRenderTargetReadback::IsSupported()
+	{
+		return UE_5_01_OR_LATER;
+	}
+
+	bool FAsyncRenderTargetReadback::Start(UTextureRenderTarget2D* RenderTarget, const FOnReadbackFinished& OnReadbackFinished)
+	{
+		if (!IsSupported() || !IsValid(RenderTarget))
+		{
+			return false;
+		}
+
+		if (RenderTarget->GameThread_GetRenderTargetResource() == nullptr)
+		{
+			return false;
+		}
+
+		const TSharedRef<FAsyncRenderTargetReadback> AsyncReadback = MakeShared<FAsyncRenderTargetReadback>(RenderTarget, OnReadbackFinished);
+		AsyncReadback->EnqueueCopy();
+
+		// The ticker holds the reference until the readback is finished.
+#if UE_5_00_OR_LATER
+		FTSTicker::GetCoreTicker().AddTicker(
+#else
+		FTicker::GetCoreTicker().AddTicker(
+#endif
+			FTickerDelegate::CreateSP(AsyncReadback, &FAsyncRenderTargetReadback::HandleOnTick)
+		);
+
+		return true;
+	}
+
+	FAsyncRenderTargetReadback::FAsyncRenderTargetReadback(UTextureRenderTarget2D* InRenderTarget, const FOnReadbackFinished& InOnReadbackFinished)
+		: RenderTarget(InRenderTarget)
+		, ImageSize(InRenderTarget->SizeX, InRenderTarget->SizeY)
+		, bIsReady(false)
+		, bIsFailed(false)
+		, OnReadbackFinished(InOnReadbackFinished)
+	{
+#if UE_5_01_OR_LATER
+		Readback = MakeUnique<FRHIGPUTextureReadback>(TEXT("GraphPrinterReadback"));
+#endif
+	}
+
+	FAsyncRenderTargetReadback::~FAsyncRenderTargetReadback()
+	{
+		// The staging buffer must not be released while the render thread is using it.
+		RenderCommandFence.Wait();
+
+#if UE_5_01_OR_LATER
+		if (Readback.IsValid())
+		{
+			ENQUEUE_RENDER_COMMAND(GraphPrinterReleaseReadback)(
+				[ReadbackToRelease = Readback.Release()](FRHICommandListImmediate& RHICmdList)
+				{
+					delete ReadbackToRelease;
+				}
+			);
+		}
+#endif
+	}
+
+	void FAsyncRenderTargetReadback::EnqueueCopy()
+	{
+#if UE_5_01_OR_LATER
+		FTextureRenderTargetResource* RenderTargetResource = RenderTarget->GameThread_GetRenderTargetResource();
+		FRHIGPUTextureReadback* ReadbackToCopy = Readback.Get();
+		ENQUEUE_RENDER_COMMAND(GraphPrinterEnqueueReadback)(
+			[RenderTargetResource, ReadbackToCopy](FRHICommandListImmediate& RHICmdList)
+			{
+				ReadbackToCopy->EnqueueCopy(RHICmdList, RenderTargetResource->GetRenderTargetTexture());
+			}
+		);
+		RenderCommandFence.BeginFence();
+#endif
+	}
+
+	void FAsyncRenderTargetReadback::EnqueuePoll()
+	{
+#if UE_5_01_OR_LATER
+		ENQUEUE_RENDER_COMMAND(GraphPrinterPollReadback)(
+			[this](FRHICommandListImmediate& RHICmdList)
+			{
+				if (!Readback->IsReady())
+				{
+					return;
+				}
+
+				int32 RowPitchInPixels = 0;
+				const auto* Source = static_cast<const FColor*>(Readback->Lock(RowPitchInPixels));
+				if (Source != nullptr && RowPitchInPixels >= ImageSize.X)
+				{
+					// Rows of the staging buffer may be padded, so copies them one by one.
+					Pixels.SetNumUninitialized(static_cast<int64>(ImageSize.X) * ImageSize.Y);
+					for (int32 Row = 0; Row < ImageSize.Y; Row++)
+					{
+						FMemory::Memcpy(
+							&Pixels[static_cast<int64>(Row) * ImageSize.X],
+							&Source[static_cast<int64>(Row) * RowPitchInPixels],
+							ImageSize.X * sizeof(FColor)
+						);
+					}
+					bIsReady = true;
+				}
+				else
+				{
+					bIsFailed = true;
+				}
+				Readback->Unlock();
+			}
+		);
+		RenderCommandFence.BeginFence();
+#endif
+	}
+
+	bool FAsyncRenderTargetReadback::HandleOnTick(float DeltaTime)
+	{
+		// Waits for the render thread to process the previous command without blocking.
+		if (!RenderCommandFence.IsFenceComplete())
+		{
+			return true;
+		}
+
+		if (!bIsReady && !bIsFailed)
+		{
+			EnqueuePoll();
+			return true;
+		}
+
+		OnReadbackFinished.ExecuteIfBound(bIsReady, ImageSize, Pixels);
+		return false;
+	}
+}
@@ -0,0 +1,79 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GraphPrinterGlobals/GraphPrinterGlobals.h"
+#include "UObject/StrongObjectPtr.h"
+#include "RenderCommandFence.h"
+#include "Containers/Ticker.h"
+
+class UTextureRenderTarget2D;
+class FRHIGPUTextureReadback;
+
+namespace GraphPrinter
+{
+	/**
+	 * A class that reads the pixels of the render target back from the GPU through a staging buffer
+	 * without blocking the game thread until the GPU finishes drawing.
+	 */
+	class FAsyncRenderTargetReadback : public TSharedFromThis<FAsyncRenderTargetReadback>
+	{
+	public:
+		// Defines the event called on the game thread when the readback is finished.
+		DECLARE_DELEGATE_ThreeParams(FOnReadbackFinished, const bool /* bIsSucceeded */, const FIntPoint& /* ImageSize */, TArray64<FColor>& /* Pixels */);
+
+	public:
+		// Returns whether the render target can be read back asynchronously in this engine version.
+		static bool IsSupported();
+
+		// Starts reading back the pixels of the render target.
+		// The render target is kept alive until the readback is finished.
+		static bool Start(UTextureRenderTarget2D* RenderTarget, const FOnReadbackFinished& OnReadbackFinished);
+
+	public:
+		// Constructor.
+		FAsyncRenderTargetReadback(UTextureRenderTarget2D* InRenderTarget, const FOnReadbackFinished& InOnReadbackFinished);
+
+		// Destructor.
+		~FAsyncRenderTargetReadback();
+
+	private:
+		// Enqueues a copy from the render target to the staging buffer after the commands to draw the widget.
+		void EnqueueCopy();
+
+		// Enqueues a command that copies the staging buffer to the pixels if the GPU has finished copying.
+		void EnqueuePoll();
+
+		// Called every frame on the game thread until the readback is finished.
+		bool HandleOnTick(float DeltaTime);
+
+	private:
+		// The render target to read back.
+		TStrongObjectPtr<UTextureRenderTarget2D> RenderTarget;
+
+		// The size of the render target.
+		FIntPoint ImageSize;
+
+#if UE_5_01_OR_LATER
+		// The staging buffer that receives the copy of the render target.
+		TUniquePtr<FRHIGPUTextureReadback> Readback;
+#endif
+
+		// The fence to know whether the render thread has processed the enqueued commands.
+		FRenderCommandFence RenderCommandFence;
+
+		// The pixels read back from the staging buffer.
+		// It is written on the render thread and read on the game thread only after the fence has been passed.
+		TArray64<FColor> Pixels;
+
+		// Whether the pixels have been read back.
+		bool bIsReady;
+
+		// Whether the staging buffer could not be read.
+		bool bIsFailed;
+
+		// The event called when the readback is finished.
+		FOnReadbackFinished OnReadbackFinished;
+	};
+}
@@ -0,0 +1,316 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#include "WidgetPrinter/Rendering/WidgetRenderTargetPool.h"
+#include "WidgetPrinter/Utilities/WidgetPrinterSettings.h"
+#include "GraphPrinterGlobals/Utilities/GraphPrinterSettings.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "Slate/WidgetRenderer.h"
+#include "RenderingThread.h"
+#include "RHI.h"
+#include "HAL/PlatformTime.h"
+
+namespace GraphPrinter
+{
+	namespace WidgetRenderTargetPool
+	{
+		// The interval to check for render targets that have not been used for a while.
+		static constexpr float EvictionCheckInterval = 1.f;
+	}
+
+	FWidgetRenderTargetPool::FPoolKey::FPoolKey(
+		const FIntPoint& InSize,
+		const EPixelFormat InFormat,
+		const TextureFilter InFilteringMode,
+		const bool bInUseGamma
+	)
+		: Size(InSize)
+		, Format(InFormat)
+		, FilteringMode(InFilteringMode)
+		, bUseGamma(bInUseGamma)
+	{
+	}
+
+	int64 FWidgetRenderTargetPool::FPoolKey::GetMemorySize() const
+	{
+		return static_cast<int64>(Size.X) * Size.Y * GPixelFormats[Format].BlockBytes;
+	}
+
+	bool FWidgetRenderTargetPool::FPoolKey::operator==(const FPoolKey& Other) const
+	{
+		return (
+			(Size == Other.Size) &&
+			(Format == Other.Format) &&
+			(FilteringMode == Other.FilteringMode) &&
+			(bUseGamma == Other.bUseGamma)
+		);
+	}
+
+	FWidgetRenderTargetPool::FWidgetRenderTargetPool()
+		: TotalMemorySize(0)
+	{
+#if UE_5_00_OR_LATER
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+#else
+		TickerHandle = FTicker::GetCoreTicker().AddTicker(
+#endif
+			FTickerDelegate::CreateRaw(this, &FWidgetRenderTargetPool::HandleOnTick),
+			WidgetRenderTargetPool::EvictionCheckInterval
+		);
+	}
+
+	FWidgetRenderTargetPool::~FWidgetRenderTargetPool()
+	{
+#if UE_5_00_OR_LATER
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+#else
+		FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+#endif
+
+		FreeRenderTargets.Empty();
+		UsedRenderTargets.Empty();
+		TotalMemorySize = 0;
+
+		// The widget renderers are deleted after the render thread has finished using them.
+		for (FPooledWidgetRenderer& PooledWidgetRenderer : WidgetRenderers)
+		{
+			BeginCleanup(PooledWidgetRenderer.WidgetRenderer);
+		}
+		WidgetRenderers.Empty();
+	}
+
+	UTextureRenderTarget2D* FWidgetRenderTargetPool::AcquireRenderTarget(
+		const FIntPoint& Size,
+		const EPixelFormat Format,
+		const TextureFilter FilteringMode,
+		const bool bUseGamma
+	)
+	{
+		const FPoolKey Key(Size, Format, FilteringMode, bUseGamma);
+
+		// Reuses the most recently released render target so that older ones are evicted first.
+		for (int32 Index = FreeRenderTargets.Num() - 1; Index >= 0; Index--)
+		{
+			if (!(FreeRenderTargets[Index].Key == Key) || !FreeRenderTargets[Index].RenderTarget.IsValid())
+			{
+				continue;
+			}
+
+			FPooledRenderTarget PooledRenderTarget = MoveTemp(FreeRenderTargets[Index]);
+			FreeRenderTargets.RemoveAt(Index);
+
+			// Clears the previous drawing result.
+			UTextureRenderTarget2D* RenderTarget = PooledRenderTarget.RenderTarget.Get();
+			RenderTarget->UpdateResourceImmediate(true);
+
+			UsedRenderTargets.Add(RenderTarget, MoveTemp(PooledRenderTarget));
+			return RenderTarget;
+		}
+
+		EvictUntilWithinBudget(Key.GetMemorySize());
+
+		UTextureRenderTarget2D* RenderTarget = CreateRenderTarget(Size, Format, FilteringMode, bUseGamma);
+		if (!IsValid(RenderTarget))
+		{
+			return nullptr;
+		}
+
+		FPooledRenderTarget PooledRenderTarget{ TStrongObjectPtr<UTextureRenderTarget2D>(RenderTarget), Key, 0. };
+		UsedRenderTargets.Add(RenderTarget, MoveTemp(PooledRenderTarget));
+		TotalMemorySize += Key.GetMemorySize();
+
+		return RenderTarget;
+	}
+
+	void FWidgetRenderTargetPool::ReleaseRenderTarget(UTextureRenderTarget2D* RenderTarget)
+	{
+		if (RenderTarget == nullptr)
+		{
+			return;
+		}
+
+		FPooledRenderTarget PooledRenderTarget{ TStrongObjectPtr<UTextureRenderTarget2D>(), FPoolKey(FIntPoint::ZeroValue, PF_Unknown, TF_Default, false), 0. };
+		if (!UsedRenderTargets.RemoveAndCopyValue(RenderTarget, PooledRenderTarget))
+		{
+			return;
+		}
+
+		// If the pool exceeds the memory limit, the render target is released immediately instead of being returned to the pool.
+		if (TotalMemorySize > GetMaxMemorySize())
+		{
+			TotalMemorySize -= PooledRenderTarget.Key.GetMemorySize();
+			return;
+		}
+
+		PooledRenderTarget.LastReleasedTime = FPlatformTime::Seconds();
+		FreeRenderTargets.Add(MoveTemp(PooledRenderTarget));
+	}
+
+	void FWidgetRenderTargetPool::DrawWidget(
+		UTextureRenderTarget2D* RenderTarget,
+		const TSharedRef<SWidget>& Widget,
+		const FVector2D& DrawSize,
+		const bool bUseGamma,
+		const float RenderingScale
+	)
+	{
+		FPooledWidgetRenderer* FreeWidgetRenderer = WidgetRenderers.FindByPredicate(
+			[](const FPooledWidgetRenderer& PooledWidgetRenderer) -> bool
+			{
+				return PooledWidgetRenderer.DrawingFence->IsFenceComplete();
+			}
+		);
+		if (FreeWidgetRenderer == nullptr)
+		{
+			FreeWidgetRenderer = &WidgetRenderers.Add_GetRef(
+				FPooledWidgetRenderer{ new FWidgetRenderer(bUseGamma, false), MakeUnique<FRenderCommandFence>() }
+			);
+		}
+
+		FreeWidgetRenderer->WidgetRenderer->SetUseGammaCorrection(bUseGamma);
+		FreeWidgetRenderer->WidgetRenderer->DrawWidget(
+			RenderTarget,
+			Widget,
+			RenderingScale,
+			DrawSize,
+			0.f
+		);
+
+		// The widget renderer is not reused until the render thread has processed the commands of this drawing.
+		FreeWidgetRenderer->DrawingFence->BeginFence();
+	}
+
+	void FWidgetRenderTargetPool::Flush()
+	{
+		while (FreeRenderTargets.Num() > 0)
+		{
+			EvictFreeRenderTargetAt(0);
+		}
+	}
+
+	UTextureRenderTarget2D* FWidgetRenderTargetPool::CreateRenderTarget(
+		const FIntPoint& Size,
+		const EPixelFormat Format,
+		const TextureFilter FilteringMode,
+		const bool bUseGamma
+	)
+	{
+		// Creates the render target manually instead of using FWidgetRenderer::CreateTargetFor
+		// to ensure bForceLinearGamma is set BEFORE InitCustomFormat creates the GPU resource.
+		// CreateTargetFor creates the resource with bForceLinearGamma=false (via InitCustomFormat)
+		// and then the code changes it to true afterwards, but UpdateResourceImmediate only clears
+		// the existing resource without recreating it with the new format.
+		// This causes the GPU resource to remain in sRGB format while the shader outputs
+		// gamma-corrected values, resulting in double gamma correction (whitish appearance).
+		UTextureRenderTarget2D* RenderTarget = NewObject<UTextureRenderTarget2D>();
+		if (!IsValid(RenderTarget))
+		{
+			UE_LOG(LogGraphPrinter, Error, TEXT("Failed to generate RenderTarget."));
+			return nullptr;
+		}
+		RenderTarget->Filter = FilteringMode;
+		RenderTarget->ClearColor = FLinearColor::Transparent;
+		RenderTarget->SRGB = bUseGamma;
+		RenderTarget->bForceLinearGamma = bUseGamma;
+		RenderTarget->TargetGamma = 1.f;
+		RenderTarget->InitCustomFormat(Size.X, Size.Y, Format, bUseGamma);
+		RenderTarget->UpdateResourceImmediate(true);
+		FlushRenderingCommands();
+
+		return RenderTarget;
+	}
+
+	void FWidgetRenderTargetPool::EvictUntilWithinBudget(const int64 SizeToAdd)
+	{
+		const int64 MaxMemorySize = GetMaxMemorySize();
+
+		// Since the render targets are added in the order of release, the first one is the oldest.
+		while (FreeRenderTargets.Num() > 0 && TotalMemorySize + SizeToAdd > MaxMemorySize)
+		{
+			EvictFreeRenderTargetAt(0);
+		}
+	}
+
+	void FWidgetRenderTargetPool::EvictFreeRenderTargetAt(const int32 Index)
+	{
+		if (!FreeRenderTargets.IsValidIndex(Index))
+		{
+			return;
+		}
+
+		TotalMemorySize -= FreeRenderTargets[Index].Key.GetMemorySize();
+		FreeRenderTargets.RemoveAt(Index);
+	}
+
+	bool FWidgetRenderTargetPool::HandleOnTick(float DeltaTime)
+	{
+		const auto& Settings = GetSettings<UWidgetPrinterSettings>();
+		const double CurrentTime = FPlatformTime::Seconds();
+
+		for (int32 Index = FreeRenderTargets.Num() - 1; Index >= 0; Index--)
+		{
+			if (CurrentTime - FreeRenderTargets[Index].LastReleasedTime >= Settings.RenderTargetPoolIdleTimeout)
+			{
+				EvictFreeRenderTargetAt(Index);
+			}
+		}
+
+		EvictUntilWithinBudget(0);
+		EvictIdleWidgetRenderers();
+
+		return true;
+	}
+
+	void FWidgetRenderTargetPool::EvictIdleWidgetRenderers()
+	{
+		bool bIsIdleWidgetRendererKept = false;
+		for (int32 Index = WidgetRenderers.Num() - 1; Index >= 0; Index--)
+		{
+			if (!WidgetRenderers[Index].DrawingFence->IsFenceComplete())
+			{
+				continue;
+			}
+
+			if (!bIsIdleWidgetRendererKept)
+			{
+				bIsIdleWidgetRendererKept = true;
+				continue;
+			}
+
+			BeginCleanup(WidgetRenderers[Index].WidgetRenderer);
+			WidgetRenderers.RemoveAt(Index);
+		}
+	}
+
+	int64 FWidgetRenderTargetPool::GetMaxMemorySize()
+	{
+		const auto& Settings = GetSettings<UWidgetPrinterSettings>();
+		return static_cast<int64>(Settings.RenderTargetPoolMaxMemoryMB) * 1024 * 1024;
+	}
+
+	namespace WidgetRenderTargetPool
+	{
+		static TUniquePtr<FWidgetRenderTargetPool> Instance;
+	}
+
+	void FWidgetRenderTargetPool::Register()
+	{
+		WidgetRenderTargetPool::Instance = MakeUnique<FWidgetRenderTargetPool>();
+	}
+
+	void FWidgetRenderTargetPool::Unregister()
+	{
+		WidgetRenderTargetPool::Instance.Reset();
+	}
+
+	bool FWidgetRenderTargetPool::IsAvailable()
+	{
+		return WidgetRenderTargetPool::Instance.IsValid();
+	}
+
+	FWidgetRenderTargetPool& FWidgetRenderTargetPool::Get()
+	{
+		// Don't call before Register is called or after Unregister is called.
+		check(WidgetRenderTargetPool::Instance.IsValid());
+		return *WidgetRenderTargetPool::Instance.Get();
+	}
+}
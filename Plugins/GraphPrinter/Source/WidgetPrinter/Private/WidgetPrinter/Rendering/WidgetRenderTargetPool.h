@@ -0,0 +1,166 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GraphPrinterGlobals/GraphPrinterGlobals.h"
+#include "UObject/StrongObjectPtr.h"
+#if UE_5_02_OR_LATER
+#include "Engine/TextureDefines.h"
+#else
+#include "Engine/Texture.h"
+#endif
+#include "PixelFormat.h"
+#include "RenderCommandFence.h"
+#include "Containers/Ticker.h"
+
+class UTextureRenderTarget2D;
+class FWidgetRenderer;
+class SWidget;
+
+namespace GraphPrinter
+{
+	/**
+	 * A class that pools the render targets used to draw widgets and the widget renderers that draw them,
+	 * so that GPU resources are not created and released every time a widget is printed.
+	 */
+	class FWidgetRenderTargetPool
+	{
+	public:
+		// Registers-Unregisters and instance getter this class.
+		static void Register();
+		static void Unregister();
+		static bool IsAvailable();
+		static FWidgetRenderTargetPool& Get();
+
+	public:
+		// Constructor.
+		FWidgetRenderTargetPool();
+
+		// Destructor.
+		~FWidgetRenderTargetPool();
+
+		// Returns a render target that is not used by anyone, creating a new one if there is no matching render target in the pool.
+		UTextureRenderTarget2D* AcquireRenderTarget(
+			const FIntPoint& Size,
+			const EPixelFormat Format,
+			const TextureFilter FilteringMode,
+			const bool bUseGamma
+		);
+
+		// Returns the render target acquired from this pool so that it can be reused.
+		// Render targets that were not acquired from this pool are ignored.
+		void ReleaseRenderTarget(UTextureRenderTarget2D* RenderTarget);
+
+		// Draws the widget on the render target with a widget renderer that the render thread has finished using.
+		// If all widget renderers are used by drawings that have not been finished, a new one is created.
+		void DrawWidget(
+			UTextureRenderTarget2D* RenderTarget,
+			const TSharedRef<SWidget>& Widget,
+			const FVector2D& DrawSize,
+			const bool bUseGamma,
+			const float RenderingScale
+		);
+
+		// Releases all render targets that are not in use.
+		void Flush();
+
+		// Creates a new render target that is not managed by the pool.
+		static UTextureRenderTarget2D* CreateRenderTarget(
+			const FIntPoint& Size,
+			const EPixelFormat Format,
+			const TextureFilter FilteringMode,
+			const bool bUseGamma
+		);
+
+	private:
+		// The conditions for reusing the render target.
+		struct FPoolKey
+		{
+		public:
+			// Constructor.
+			FPoolKey(const FIntPoint& InSize, const EPixelFormat InFormat, const TextureFilter InFilteringMode, const bool bInUseGamma);
+
+			// Returns the amount of video memory used by the render target of this key.
+			int64 GetMemorySize() const;
+
+			// Overload operators.
+			bool operator==(const FPoolKey& Other) const;
+
+		public:
+			// The size of the render target.
+			// Since the render target is exported as a whole image, render targets of different sizes are not shared.
+			FIntPoint Size;
+
+			// The pixel format of the render target.
+			EPixelFormat Format;
+
+			// The texture filtering mode of the render target.
+			TextureFilter FilteringMode;
+
+			// Whether the render target uses gamma.
+			bool bUseGamma;
+		};
+
+		// The render target held by this pool.
+		struct FPooledRenderTarget
+		{
+		public:
+			// The render target to reuse.
+			TStrongObjectPtr<UTextureRenderTarget2D> RenderTarget;
+
+			// The conditions under which the render target was created.
+			FPoolKey Key;
+
+			// The time when the render target was last returned to the pool.
+			double LastReleasedTime;
+		};
+
+		// The widget renderer held by this pool.
+		struct FPooledWidgetRenderer
+		{
+		public:
+			// The widget renderer to reuse.
+			FWidgetRenderer* WidgetRenderer;
+
+			// The fence that is passed when the render thread has finished the last drawing of the widget renderer.
+			TUniquePtr<FRenderCommandFence> DrawingFence;
+		};
+
+		// Releases the widget renderers that are not drawing, leaving one to reuse.
+		void EvictIdleWidgetRenderers();
+
+		// Releases free render targets in order of oldest release time until the total size is within the memory limit.
+		void EvictUntilWithinBudget(const int64 SizeToAdd);
+
+		// Releases the free render target at the specified index.
+		void EvictFreeRenderTargetAt(const int32 Index);
+
+		// Called at regular intervals to release render targets that have not been used for a while.
+		bool HandleOnTick(float DeltaTime);
+
+		// Returns the maximum amount of video memory that the render targets held by this pool can use.
+		static int64 GetMaxMemorySize();
+
+	private:
+		// The render targets that are not used by anyone.
+		TArray<FPooledRenderTarget> FreeRenderTargets;
+
+		// The render targets that are being used by the printers.
+		TMap<UTextureRenderTarget2D*, FPooledRenderTarget> UsedRenderTargets;
+
+		// The total amount of video memory used by the render targets held by this pool.
+		int64 TotalMemorySize;
+
+		// The widget renderers that draw the widgets.
+		// Since a widget renderer cannot be reused until the render thread has finished drawing with it, one is used for each drawing in flight.
+		TArray<FPooledWidgetRenderer> WidgetRenderers;
+
+		// The handle of the ticker that releases unused render targets.
+#if UE_5_00_OR_LATER
+		FTSTicker::FDelegateHandle TickerHandle;
+#else
+		FDelegateHandle TickerHandle;
+#endif
+	};
+}
@@ -2,11 +2,22 @@
 
 #include "WidgetPrinter/ISupportedWidgetRegistry.h"
 #include "WidgetPrinter/IWidgetPrinterRegistry.h"
-#include "WidgetPrinter/Utilities/WidgetPrinterUtils.h"
+#include "WidgetPrinter/Utilities/WidgetPrinterSettings.h"
+#include "WidgetPrinter/Utilities/CastSlateWidget.h"
+#include "GraphPrinterGlobals/GraphPrinterGlobals.h"
 #include "Framework/Application/SlateApplication.h"
+#include "Framework/Docking/SDockingTabStack.h"
+#include "Widgets/Docking/SDockTab.h"
+#include "HAL/PlatformTime.h"
 
 namespace GraphPrinter
 {
+	namespace SupportedWidgetRegistryInternal
+	{
+		// The number of widgets visited between checks of the elapsed time.
+		static constexpr int32 NumWidgetsPerTimeCheck = 64;
+	}
+	
 	class FSupportedWidgetRegistryImpl : public ISupportedWidgetRegistry
 	{
 	public:
@@ -28,10 +39,55 @@ namespace GraphPrinter
 		// Called when before slate application ticks.
 		void HandleOnPreTick(const float DeltaTime);
 
+		// Visits the widgets waiting to be checked until the time limit for this frame is reached.
+		// When all widgets have been visited, replaces the registered widgets with the widgets found in this collection.
+		void ProcessPendingWidgets();
+
+		// Adds the children of the widget to the widgets waiting to be checked.
+		void PushChildWidgets(const TSharedRef<SWidget>& Widget, const TSharedPtr<SDockTab>& OwnerTab);
+
+		// Handles the docking tab stack so that only the content of the tab in the foreground is checked.
+		// If the content has been checked before, reuses the results without checking it again.
+		void ProcessDockingTabStack(const TSharedRef<SDockingTabStack>& DockingTabStack, const TSharedPtr<SDockTab>& OwnerTab);
+
+		// Adds a widget supported by either printer that was found in the content of the tab.
+		void AddSupportedWidget(const FSupportedWidget& SupportedWidget, const TSharedPtr<SDockTab>& OwnerTab);
+
 	private:
 		// The list of widgets supported by either printer.
 		TArray<FSupportedWidget> RegisteredWidgets;
 
+		// The list of widgets supported by either printer found in the collection in progress.
+		// Widgets in tabs that have moved to the background or windows that are no longer active are not carried over from the previous collection.
+		TArray<FSupportedWidget> CollectingWidgets;
+
+		// A widget waiting to be checked and the tab whose content contains it.
+		struct FPendingWidget
+		{
+		public:
+			TWeakPtr<SWidget> Widget;
+			TWeakPtr<SDockTab> OwnerTab;
+		};
+		TArray<FPendingWidget> PendingWidgets;
+
+		// The result of checking the content of the tab.
+		struct FScannedTab
+		{
+		public:
+			// The tab whose content was checked.
+			TWeakPtr<SDockTab> Tab;
+
+			// The content of the tab when it was checked.
+			TWeakPtr<SWidget> Content;
+
+			// The docking tab stacks found in the content, whose tabs have their own results.
+			TArray<TWeakPtr<SDockingTabStack>> NestedDockingTabStacks;
+
+			// The widgets supported by either printer found in the content.
+			TArray<FSupportedWidget> SupportedWidgets;
+		};
+		TArray<FScannedTab> ScannedTabs;
+
 		// The widget selected in a menu from RegisteredWidgets.
 		FGuid SelectedWidgetIdentifier;
 
@@ -64,24 +120,34 @@ namespace GraphPrinter
 
 	void FSupportedWidgetRegistryImpl::CollectSupportedWidget()
 	{
-		RegisteredWidgets.Empty();
-		
-		FWidgetPrinterUtils::EnumerateChildWidgets(
-			FSlateApplication::Get().GetActiveTopLevelWindow(),
-			[&](const TSharedPtr<SWidget>& ChildWidget) -> bool
-			{
-				if (ChildWidget.IsValid())
-				{
-					const TOptional<FSupportedWidget>& SupportedWidget = IWidgetPrinterRegistry::Get().CheckIfSupported(ChildWidget.ToSharedRef());
-					if (SupportedWidget.IsSet())
-					{
-						RegisteredWidgets.AddUnique(SupportedWidget.GetValue());
-					}
-				}
+		// If the previous collection is still in progress, continues it.
+		if (PendingWidgets.Num() > 0)
+		{
+			ProcessPendingWidgets();
+			return;
+		}
 
-				return true;
+		// Discards the results of the closed tabs.
+		ScannedTabs.RemoveAll(
+			[](const FScannedTab& ScannedTab) -> bool
+			{
+				return (!ScannedTab.Tab.IsValid() || !ScannedTab.Content.IsValid());
 			}
 		);
+		
+		CollectingWidgets.Reset();
+		
+		const TSharedPtr<SWindow> ActiveTopLevelWindow = FSlateApplication::Get().GetActiveTopLevelWindow();
+		if (!ActiveTopLevelWindow.IsValid())
+		{
+			RegisteredWidgets.Reset();
+			return;
+		}
+
+		// Instead of checking the whole window at once, checks a part of it in each frame not to cause a hitch.
+		// The registered widgets are kept until the collection is complete so that the menu doesn't lose them in the meantime.
+		PushChildWidgets(ActiveTopLevelWindow.ToSharedRef(), nullptr);
+		ProcessPendingWidgets();
 	}
 
 	const TArray<FSupportedWidget>& FSupportedWidgetRegistryImpl::GetSupportedWidgets() const
@@ -134,6 +200,164 @@ namespace GraphPrinter
 		}
 		
 		bWasAnyMenuVisibleInPreviousFrame = FSlateApplication::Get().AnyMenusVisible();
+
+		if (PendingWidgets.Num() > 0)
+		{
+			ProcessPendingWidgets();
+		}
+	}
+
+	void FSupportedWidgetRegistryImpl::ProcessPendingWidgets()
+	{
+		const auto& Settings = GetSettings<UWidgetPrinterSettings>();
+		const double EndTime = FPlatformTime::Seconds() + (Settings.SupportedWidgetCollectionTimeBudget / 1000.0);
+
+		const auto& WidgetPrinterRegistry = IWidgetPrinterRegistry::Get();
+		int32 NumVisitedWidgets = 0;
+		while (PendingWidgets.Num() > 0)
+		{
+			// Since getting the time is not free, checks it only once every few widgets.
+			NumVisitedWidgets++;
+			if ((NumVisitedWidgets % SupportedWidgetRegistryInternal::NumWidgetsPerTimeCheck) == 0)
+			{
+				if (FPlatformTime::Seconds() > EndTime)
+				{
+					break;
+				}
+			}
+			
+			const FPendingWidget PendingWidget = PendingWidgets.Pop();
+			const TSharedPtr<SWidget> Widget = PendingWidget.Widget.Pin();
+			if (!Widget.IsValid())
+			{
+				continue;
+			}
+			const TSharedPtr<SDockTab> OwnerTab = PendingWidget.OwnerTab.Pin();
+
+			const TSharedPtr<SDockingTabStack> DockingTabStack = GP_CAST_SLATE_WIDGET(SDockingTabStack, Widget);
+			if (DockingTabStack.IsValid())
+			{
+				ProcessDockingTabStack(DockingTabStack.ToSharedRef(), OwnerTab);
+				continue;
+			}
+			
+			const TOptional<FSupportedWidget>& SupportedWidget = WidgetPrinterRegistry.CheckIfSupported(Widget.ToSharedRef());
+			if (SupportedWidget.IsSet())
+			{
+				AddSupportedWidget(SupportedWidget.GetValue(), OwnerTab);
+			}
+
+			PushChildWidgets(Widget.ToSharedRef(), OwnerTab);
+		}
+
+		if (PendingWidgets.Num() == 0)
+		{
+			RegisteredWidgets = MoveTemp(CollectingWidgets);
+			CollectingWidgets.Reset();
+		}
+	}
+
+	void FSupportedWidgetRegistryImpl::PushChildWidgets(const TSharedRef<SWidget>& Widget, const TSharedPtr<SDockTab>& OwnerTab)
+	{
+		FChildren* Children = Widget->GetChildren();
+		if (Children == nullptr)
+		{
+			return;
+		}
+
+		// Pushes the children in reverse order so that they are checked in the same order as they are arranged.
+		for (int32 Index = Children->Num() - 1; Index >= 0; Index--)
+		{
+			PendingWidgets.Add({ Children->GetChildAt(Index), OwnerTab });
+		}
+	}
+
+	void FSupportedWidgetRegistryImpl::ProcessDockingTabStack(const TSharedRef<SDockingTabStack>& DockingTabStack, const TSharedPtr<SDockTab>& OwnerTab)
+	{
+		// Remembers the nested docking tab stack so that it can be reached without checking the content of the owner tab again.
+		if (OwnerTab.IsValid())
+		{
+			if (FScannedTab* OwnerScannedTab = ScannedTabs.FindByPredicate(
+				[&OwnerTab](const FScannedTab& ScannedTab) -> bool
+				{
+					return (ScannedTab.Tab.Pin() == OwnerTab);
+				}
+			))
+			{
+				OwnerScannedTab->NestedDockingTabStacks.AddUnique(DockingTabStack);
+			}
+		}
+		
+		// The contents of the tabs in the background are not displayed and cannot be printed.
+		TSharedPtr<SDockTab> ForegroundTab = nullptr;
+		for (const TSharedRef<SDockTab>& Tab : DockingTabStack->GetTabs().AsArrayCopy())
+		{
+			if (Tab->IsForeground())
+			{
+				ForegroundTab = Tab;
+				break;
+			}
+		}
+		if (!ForegroundTab.IsValid())
+		{
+			return;
+		}
+		
+		const TSharedPtr<SWidget> Content = ForegroundTab->GetContent();
+		const int32 ScannedTabIndex = ScannedTabs.IndexOfByPredicate(
+			[&ForegroundTab](const FScannedTab& ScannedTab) -> bool
+			{
+				return (ScannedTab.Tab.Pin() == ForegroundTab);
+			}
+		);
+		
+		// Only the contents of tabs that have been opened or replaced since the last collection are checked.
+		if (ScannedTabs.IsValidIndex(ScannedTabIndex) && ScannedTabs[ScannedTabIndex].Content.Pin() == Content)
+		{
+			const FScannedTab& ScannedTab = ScannedTabs[ScannedTabIndex];
+			for (const FSupportedWidget& SupportedWidget : ScannedTab.SupportedWidgets)
+			{
+				if (SupportedWidget.IsValid())
+				{
+					CollectingWidgets.AddUnique(SupportedWidget);
+				}
+			}
+			for (const TWeakPtr<SDockingTabStack>& NestedDockingTabStack : ScannedTab.NestedDockingTabStacks)
+			{
+				PendingWidgets.Add({ NestedDockingTabStack, ForegroundTab });
+			}
+			return;
+		}
+
+		if (ScannedTabs.IsValidIndex(ScannedTabIndex))
+		{
+			ScannedTabs.RemoveAtSwap(ScannedTabIndex);
+		}
+		FScannedTab& NewScannedTab = ScannedTabs.AddDefaulted_GetRef();
+		NewScannedTab.Tab = ForegroundTab;
+		NewScannedTab.Content = Content;
+		
+		PendingWidgets.Add({ Content, ForegroundTab });
+	}
+
+	void FSupportedWidgetRegistryImpl::AddSupportedWidget(const FSupportedWidget& SupportedWidget, const TSharedPtr<SDockTab>& OwnerTab)
+	{
+		CollectingWidgets.AddUnique(SupportedWidget);
+
+		if (!OwnerTab.IsValid())
+		{
+			return;
+		}
+
+		if (FScannedTab* OwnerScannedTab = ScannedTabs.FindByPredicate(
+			[&OwnerTab](const FScannedTab& ScannedTab) -> bool
+			{
+				return (ScannedTab.Tab.Pin() == OwnerTab);
+			}
+		))
+		{
+			OwnerScannedTab->SupportedWidgets.AddUnique(SupportedWidget);
+		}
 	}
 
 	namespace SupportedWidgetHolder
@@ -0,0 +1,105 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "WidgetPrinter/Utilities/ExportManifest.h"
+#include "GraphPrinterGlobals/GraphPrinterGlobals.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GraphPrinter
+{
+	namespace ExportManifestTest
+	{
+		// Returns an empty directory used as the output directory of the test.
+		FString MakeOutputDirectory()
+		{
+			const FString OutputDirectory = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("GraphPrinter"), TEXT("ExportManifest"));
+			IFileManager::Get().DeleteDirectory(*OutputDirectory, false, true);
+			IFileManager::Get().MakeDirectory(*OutputDirectory, true);
+			return OutputDirectory;
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FExportManifestCalculateHashTest,
+	"GraphPrinter.WidgetPrinter.ExportManifest.CalculateHash",
+#if UE_5_05_OR_LATER
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter
+#else
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter
+#endif
+)
+
+bool FExportManifestCalculateHashTest::RunTest(const FString& Parameters)
+{
+	using namespace GraphPrinter;
+
+	// The expected values are the SHA-1 of the UTF-8 bytes, so they are the same on every platform.
+	TestEqual(TEXT("The hash of the empty text"), FExportManifest::CalculateHash(TEXT("")), FString(TEXT("DA39A3EE5E6B4B0D3255BFEF95601890AFD80709")));
+	TestEqual(TEXT("The hash of the ascii text"), FExportManifest::CalculateHash(TEXT("abc")), FString(TEXT("A9993E364706816ABA3E25717850C26C9CD0D89D")));
+	TestEqual(TEXT("The hash of the non-ascii text"), FExportManifest::CalculateHash(TEXT("\u30B0\u30E9\u30D5")), FString(TEXT("8F32FCF6A8E6E2BC32D07C7B5E030C9CFE9AF30F")));
+	TestNotEqual(TEXT("The hash of the different text"), FExportManifest::CalculateHash(TEXT("abd")), FExportManifest::CalculateHash(TEXT("abc")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FExportManifestRecordTest,
+	"GraphPrinter.WidgetPrinter.ExportManifest.Record",
+#if UE_5_05_OR_LATER
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter
+#else
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter
+#endif
+)
+
+bool FExportManifestRecordTest::RunTest(const FString& Parameters)
+{
+	using namespace GraphPrinter;
+
+	const FString OutputDirectory = ExportManifestTest::MakeOutputDirectory();
+	const FString ImageFilename = FPaths::Combine(OutputDirectory, TEXT("Graph.png"));
+	if (!TestTrue(TEXT("Wrote the image file"), FFileHelper::SaveStringToFile(TEXT("Image"), *ImageFilename)))
+	{
+		return true;
+	}
+
+	const FString Key = TEXT("/Game/Blueprint.Blueprint:EventGraph");
+	const FString Hash = FExportManifest::CalculateHash(TEXT("Content"));
+	const FString ChangedHash = FExportManifest::CalculateHash(TEXT("Changed content"));
+
+	// Uses its own instance so that the manifests of the running editor are not changed.
+	{
+		FExportManifest ExportManifest;
+
+		FString Filename;
+		TestFalse(TEXT("The content that has not been recorded is not up to date"), ExportManifest.FindUpToDateFile(OutputDirectory, Key, Hash, Filename));
+
+		ExportManifest.Record(ImageFilename, Key, Hash);
+		TestTrue(TEXT("The recorded content is up to date"), ExportManifest.FindUpToDateFile(OutputDirectory, Key, Hash, Filename));
+		TestEqual(TEXT("The recorded image file"), Filename, FPaths::ConvertRelativePathToFull(ImageFilename));
+		TestFalse(TEXT("The changed content is not up to date"), ExportManifest.FindUpToDateFile(OutputDirectory, Key, ChangedHash, Filename));
+	}
+
+	// The manifest is written when the instance is destroyed and loaded again by a new instance.
+	{
+		FExportManifest ExportManifest;
+
+		FString Filename;
+		TestTrue(TEXT("The content recorded in the manifest file is up to date"), ExportManifest.FindUpToDateFile(OutputDirectory, Key, Hash, Filename));
+
+		IFileManager::Get().Delete(*ImageFilename);
+		TestFalse(TEXT("The content whose image file has been deleted is not up to date"), ExportManifest.FindUpToDateFile(OutputDirectory, Key, Hash, Filename));
+	}
+
+	IFileManager::Get().DeleteDirectory(*OutputDirectory, false, true);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,379 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "WidgetPrinter/ImageWriters/ParallelPngEncoder.h"
+#include "GraphPrinterGlobals/GraphPrinterGlobals.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GraphPrinter
+{
+	namespace ParallelPngEncoderTest
+	{
+		// The size of the test image, which is large enough to be split into several bands.
+		static const FIntPoint ImageSize = FIntPoint(700, 900);
+
+		// The number of rows added at a time when streaming, which is not aligned with the bands.
+		static constexpr int32 RowsPerAdd = 123;
+
+		// Reads the value written in big endian.
+		uint32 ReadUint32(const uint8* Source)
+		{
+			return (static_cast<uint32>(Source[0]) << 24) | (static_cast<uint32>(Source[1]) << 16) | (static_cast<uint32>(Source[2]) << 8) | Source[3];
+		}
+
+		// Returns the predictor of the paeth filter.
+		uint8 PaethPredictor(const uint8 Left, const uint8 Above, const uint8 UpperLeft)
+		{
+			const int32 Estimate = static_cast<int32>(Left) + Above - UpperLeft;
+			const int32 DistanceToLeft = FMath::Abs(Estimate - Left);
+			const int32 DistanceToAbove = FMath::Abs(Estimate - Above);
+			const int32 DistanceToUpperLeft = FMath::Abs(Estimate - UpperLeft);
+			if (DistanceToLeft <= DistanceToAbove && DistanceToLeft <= DistanceToUpperLeft)
+			{
+				return Left;
+			}
+			if (DistanceToAbove <= DistanceToUpperLeft)
+			{
+				return Above;
+			}
+			return UpperLeft;
+		}
+
+		// Creates an image with smooth gradients and noise so that every filter type and translucent pixels appear.
+		TArray<FColor> MakeTrueColorImage(const bool bIsOpaque)
+		{
+			FRandomStream RandomStream(1234);
+			TArray<FColor> Pixels;
+			Pixels.SetNumUninitialized(ImageSize.X * ImageSize.Y);
+			for (int32 Y = 0; Y < ImageSize.Y; Y++)
+			{
+				for (int32 X = 0; X < ImageSize.X; X++)
+				{
+					FColor& Pixel = Pixels[Y * ImageSize.X + X];
+					Pixel.R = static_cast<uint8>(X);
+					Pixel.G = static_cast<uint8>(Y);
+					Pixel.B = static_cast<uint8>(RandomStream.RandRange(0, 255));
+					Pixel.A = bIsOpaque ? 255 : static_cast<uint8>(X + Y);
+				}
+			}
+			return Pixels;
+		}
+
+		// Creates an image that uses only the specified number of colors, including a translucent one.
+		TArray<FColor> MakeFewColorsImage(const int32 NumColors)
+		{
+			TArray<FColor> Colors;
+			for (int32 Index = 0; Index < NumColors; Index++)
+			{
+				Colors.Add(FColor(static_cast<uint8>(Index * 37), static_cast<uint8>(Index * 11), static_cast<uint8>(255 - Index), (Index == 1) ? 128 : 255));
+			}
+
+			TArray<FColor> Pixels;
+			Pixels.SetNumUninitialized(ImageSize.X * ImageSize.Y);
+			for (int32 Y = 0; Y < ImageSize.Y; Y++)
+			{
+				for (int32 X = 0; X < ImageSize.X; X++)
+				{
+					Pixels[Y * ImageSize.X + X] = Colors[((X / 7) + (Y / 5)) % NumColors];
+				}
+			}
+			return Pixels;
+		}
+
+		// Decodes the png written by the encoder with zlib only, independently of the encoder.
+		// The IDAT chunks are joined and inflated as one zlib stream, which also verifies the header and the adler-32 checksum.
+		bool Decode(FAutomationTestBase& Test, const TArray64<uint8>& PngData, TArray<FColor>& OutPixels)
+		{
+			static const uint8 Signature[] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+			if (!Test.TestTrue(TEXT("The png starts with the signature"), PngData.Num() > 8 && FMemory::Memcmp(PngData.GetData(), Signature, 8) == 0))
+			{
+				return false;
+			}
+
+			int32 Width = 0;
+			int32 Height = 0;
+			uint8 BitDepth = 0;
+			uint8 ColorType = 0;
+			TArray<FColor> Palette;
+			TArray<uint8> ZlibStream;
+			bool bHasEnd = false;
+
+			int64 Offset = 8;
+			while (Offset + 12 <= PngData.Num() && !bHasEnd)
+			{
+				const uint32 DataSize = ReadUint32(PngData.GetData() + Offset);
+				if (!Test.TestTrue(TEXT("The chunk fits in the png"), Offset + 12 + DataSize <= PngData.Num()))
+				{
+					return false;
+				}
+
+				const uint8* Type = PngData.GetData() + Offset + 4;
+				const uint8* Data = Type + 4;
+				const uint32 Crc = static_cast<uint32>(crc32(crc32(0, nullptr, 0), Type, 4 + DataSize));
+				if (!Test.TestEqual(TEXT("The crc of the chunk"), ReadUint32(Data + DataSize), Crc))
+				{
+					return false;
+				}
+
+				if (FMemory::Memcmp(Type, "IHDR", 4) == 0)
+				{
+					Width = static_cast<int32>(ReadUint32(Data));
+					Height = static_cast<int32>(ReadUint32(Data + 4));
+					BitDepth = Data[8];
+					ColorType = Data[9];
+				}
+				else if (FMemory::Memcmp(Type, "PLTE", 4) == 0)
+				{
+					for (uint32 Index = 0; Index + 3 <= DataSize; Index += 3)
+					{
+						Palette.Add(FColor(Data[Index], Data[Index + 1], Data[Index + 2], 255));
+					}
+				}
+				else if (FMemory::Memcmp(Type, "tRNS", 4) == 0)
+				{
+					for (uint32 Index = 0; Index < DataSize && static_cast<int32>(Index) < Palette.Num(); Index++)
+					{
+						Palette[Index].A = Data[Index];
+					}
+				}
+				else if (FMemory::Memcmp(Type, "IDAT", 4) == 0)
+				{
+					ZlibStream.Append(Data, DataSize);
+				}
+				else if (FMemory::Memcmp(Type, "IEND", 4) == 0)
+				{
+					bHasEnd = true;
+				}
+
+				Offset += 12 + DataSize;
+			}
+
+			if (!Test.TestTrue(TEXT("The png ends with the end chunk"), bHasEnd) ||
+				!Test.TestEqual(TEXT("The width of the png"), Width, ImageSize.X) ||
+				!Test.TestEqual(TEXT("The height of the png"), Height, ImageSize.Y))
+			{
+				return false;
+			}
+
+			const bool bIsIndexed = (ColorType == 3);
+			int32 BytesPerPixel = 0;
+			switch (ColorType)
+			{
+			case 2: BytesPerPixel = 3; break;
+			case 3: BytesPerPixel = 1; break;
+			case 6: BytesPerPixel = 4; break;
+			default: break;
+			}
+			if (!Test.TestTrue(TEXT("The color type is one written by the encoder"), BytesPerPixel > 0) ||
+				!Test.TestTrue(TEXT("The bit depth is valid for the color type"), bIsIndexed ? (BitDepth == 1 || BitDepth == 2 || BitDepth == 4 || BitDepth == 8) : (BitDepth == 8)))
+			{
+				return false;
+			}
+
+			const int32 NumRowBytes = bIsIndexed ? ((Width * BitDepth + 7) / 8) : (Width * BytesPerPixel);
+			TArray<uint8> FilteredRows;
+			FilteredRows.SetNumUninitialized(Height * (NumRowBytes + 1));
+			uLongf UncompressedSize = FilteredRows.Num();
+			const int32 Result = uncompress(FilteredRows.GetData(), &UncompressedSize, ZlibStream.GetData(), ZlibStream.Num());
+			if (!Test.TestEqual(TEXT("The IDAT chunks form a single valid zlib stream"), Result, Z_OK) ||
+				!Test.TestEqual(TEXT("The size of the inflated rows"), static_cast<int32>(UncompressedSize), FilteredRows.Num()))
+			{
+				return false;
+			}
+
+			TArray<uint8> Previous;
+			Previous.SetNumZeroed(NumRowBytes);
+			TArray<uint8> Current;
+			Current.SetNumUninitialized(NumRowBytes);
+
+			OutPixels.SetNumUninitialized(Width * Height);
+			for (int32 Y = 0; Y < Height; Y++)
+			{
+				const uint8* FilteredRow = FilteredRows.GetData() + Y * (NumRowBytes + 1);
+				const uint8 FilterType = FilteredRow[0];
+				if (!Test.TestTrue(TEXT("The filter type is valid"), FilterType <= 4))
+				{
+					return false;
+				}
+
+				for (int32 Index = 0; Index < NumRowBytes; Index++)
+				{
+					const uint8 Left = (Index >= BytesPerPixel) ? Current[Index - BytesPerPixel] : 0;
+					const uint8 Above = Previous[Index];
+					const uint8 UpperLeft = (Index >= BytesPerPixel) ? Previous[Index - BytesPerPixel] : 0;
+
+					uint8 Predictor = 0;
+					switch (FilterType)
+					{
+					case 1: Predictor = Left; break;
+					case 2: Predictor = Above; break;
+					case 3: Predictor = static_cast<uint8>((static_cast<int32>(Left) + Above) / 2); break;
+					case 4: Predictor = PaethPredictor(Left, Above, UpperLeft); break;
+					default: break;
+					}
+					Current[Index] = static_cast<uint8>(FilteredRow[1 + Index] + Predictor);
+				}
+
+				for (int32 X = 0; X < Width; X++)
+				{
+					FColor& Pixel = OutPixels[Y * Width + X];
+					if (bIsIndexed)
+					{
+						const int32 PixelsPerByte = 8 / BitDepth;
+						const int32 Shift = 8 - BitDepth * (X % PixelsPerByte + 1);
+						const int32 PaletteIndex = (Current[X / PixelsPerByte] >> Shift) & ((1 << BitDepth) - 1);
+						if (!Test.TestTrue(TEXT("The palette index is in the palette"), Palette.IsValidIndex(PaletteIndex)))
+						{
+							return false;
+						}
+						Pixel = Palette[PaletteIndex];
+					}
+					else
+					{
+						const uint8* Source = Current.GetData() + X * BytesPerPixel;
+						Pixel = FColor(Source[0], Source[1], Source[2], (BytesPerPixel == 4) ? Source[3] : 255);
+					}
+				}
+
+				Swap(Previous, Current);
+			}
+
+			return true;
+		}
+
+		// Decodes the png and tests whether it has the same pixels as the source image.
+		void TestPixelsMatch(FAutomationTestBase& Test, const FString& What, const TArray64<uint8>& PngData, const TArray<FColor>& ExpectedPixels)
+		{
+			TArray<FColor> DecodedPixels;
+			if (!Decode(Test, PngData, DecodedPixels))
+			{
+				Test.AddError(FString::Printf(TEXT("Failed to decode the png (%s)."), *What));
+				return;
+			}
+
+			for (int32 Index = 0; Index < ExpectedPixels.Num(); Index++)
+			{
+				if (DecodedPixels[Index] != ExpectedPixels[Index])
+				{
+					Test.AddError(FString::Printf(
+						TEXT("The pixel at (%d, %d) is %s but %s was expected (%s)."),
+						Index % ImageSize.X,
+						Index / ImageSize.X,
+						*DecodedPixels[Index].ToString(),
+						*ExpectedPixels[Index].ToString(),
+						*What
+					));
+					return;
+				}
+			}
+		}
+
+		// Returns the color type written in the header chunk.
+		uint8 GetColorType(const TArray64<uint8>& PngData)
+		{
+			// The signature, the length and type of the header chunk, the width, the height and the bit depth.
+			static constexpr int32 ColorTypeOffset = 8 + 8 + 4 + 4 + 1;
+			return (PngData.Num() > ColorTypeOffset) ? PngData[ColorTypeOffset] : 0;
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FParallelPngEncoderEncodeTest,
+	"GraphPrinter.WidgetPrinter.ParallelPngEncoder.Encode",
+#if UE_5_05_OR_LATER
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter
+#else
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter
+#endif
+)
+
+bool FParallelPngEncoderEncodeTest::RunTest(const FString& Parameters)
+{
+	using namespace GraphPrinter;
+
+	struct FTestCase
+	{
+		const TCHAR* Name;
+		TArray<FColor> Pixels;
+		EPngColorReduction ColorReduction;
+		uint8 ExpectedColorType;
+	};
+	const FTestCase TestCases[] = {
+		{ TEXT("RGBA"), ParallelPngEncoderTest::MakeTrueColorImage(false), EPngColorReduction::None, 6 },
+		{ TEXT("Translucent pixels are kept as RGBA"), ParallelPngEncoderTest::MakeTrueColorImage(false), EPngColorReduction::RemoveOpaqueAlpha, 6 },
+		{ TEXT("Opaque pixels are written as RGB"), ParallelPngEncoderTest::MakeTrueColorImage(true), EPngColorReduction::Palette, 2 },
+		{ TEXT("2 colors"), ParallelPngEncoderTest::MakeFewColorsImage(2), EPngColorReduction::Palette, 3 },
+		{ TEXT("4 colors"), ParallelPngEncoderTest::MakeFewColorsImage(4), EPngColorReduction::Palette, 3 },
+		{ TEXT("16 colors"), ParallelPngEncoderTest::MakeFewColorsImage(16), EPngColorReduction::Palette, 3 },
+		{ TEXT("256 colors"), ParallelPngEncoderTest::MakeFewColorsImage(256), EPngColorReduction::Palette, 3 },
+	};
+
+	for (const FTestCase& TestCase : TestCases)
+	{
+		TArray64<uint8> PngData;
+		if (!TestTrue(FString::Printf(TEXT("Encoded the image (%s)"), TestCase.Name), FParallelPngEncoder::Encode(ParallelPngEncoderTest::ImageSize, TestCase.Pixels.GetData(), 0, PngData, TestCase.ColorReduction)))
+		{
+			continue;
+		}
+
+		TestEqual(FString::Printf(TEXT("The color type (%s)"), TestCase.Name), ParallelPngEncoderTest::GetColorType(PngData), TestCase.ExpectedColorType);
+		ParallelPngEncoderTest::TestPixelsMatch(*this, TestCase.Name, PngData, TestCase.Pixels);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FParallelPngEncoderStreamingTest,
+	"GraphPrinter.WidgetPrinter.ParallelPngEncoder.Streaming",
+#if UE_5_05_OR_LATER
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter
+#else
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter
+#endif
+)
+
+bool FParallelPngEncoderStreamingTest::RunTest(const FString& Parameters)
+{
+	using namespace GraphPrinter;
+
+	const TArray<FColor> Pixels = ParallelPngEncoderTest::MakeTrueColorImage(false);
+
+	// Uses each compression level so that the zlib header written for the first band matches the level.
+	for (const int32 CompressionQuality : { 0, 1, 50, 100 })
+	{
+		const FString What = FString::Printf(TEXT("Streaming with quality %d"), CompressionQuality);
+
+		TArray64<uint8> PngData;
+		FParallelPngEncoder Encoder(ParallelPngEncoderTest::ImageSize, CompressionQuality);
+		Encoder.BeginImage(PngData);
+
+		bool bIsSucceeded = true;
+		for (int32 StartRow = 0; StartRow < ParallelPngEncoderTest::ImageSize.Y && bIsSucceeded; StartRow += ParallelPngEncoderTest::RowsPerAdd)
+		{
+			const int32 NumRows = FMath::Min(ParallelPngEncoderTest::RowsPerAdd, ParallelPngEncoderTest::ImageSize.Y - StartRow);
+			bIsSucceeded = Encoder.AddRows(Pixels.GetData() + StartRow * ParallelPngEncoderTest::ImageSize.X, NumRows);
+			bIsSucceeded = bIsSucceeded && Encoder.FlushFinishedBands(PngData, 1);
+		}
+		bIsSucceeded = bIsSucceeded && Encoder.EndImage(PngData);
+
+		if (!TestTrue(FString::Printf(TEXT("Encoded the image (%s)"), *What), bIsSucceeded))
+		{
+			continue;
+		}
+
+		ParallelPngEncoderTest::TestPixelsMatch(*this, What, PngData, Pixels);
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,112 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "WidgetPrinter/PrintJobQueueImpl.h"
+#include "WidgetPrinter/Types/PrintWidgetOptions.h"
+#include "GraphPrinterGlobals/GraphPrinterGlobals.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Text/STextBlock.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GraphPrinter
+{
+	namespace PrintJobQueueTest
+	{
+		/**
+		 * A print job queue that finds the widget to print without the printers, so that the merging of the requests can be tested by itself.
+		 */
+		class FTestPrintJobQueue : public FPrintJobQueueImpl
+		{
+		protected:
+			// FPrintJobQueueImpl interface.
+			virtual TSharedPtr<SWidget> FindWidgetToPrint(UPrintWidgetOptions* Options) const override
+			{
+				// Finds the content of the container in the same way as the printers find the widget to print from the search target.
+				const TSharedPtr<SWidget> SearchTarget = Options->SearchTarget;
+				if (!SearchTarget.IsValid())
+				{
+					return nullptr;
+				}
+
+				FChildren* Children = SearchTarget->GetChildren();
+				if (Children != nullptr && Children->Num() > 0)
+				{
+					return Children->GetChildAt(0);
+				}
+
+				return SearchTarget;
+			}
+			// End of FPrintJobQueueImpl interface.
+		};
+
+		// Creates the options to print the whole widget found from the search target.
+		UPrintWidgetOptions* MakePrintOptions(const TSharedPtr<SWidget>& SearchTarget, const UPrintWidgetOptions::EPrintScope PrintScope = UPrintWidgetOptions::EPrintScope::All)
+		{
+			UPrintWidgetOptions* PrintOptions = NewObject<UPrintWidgetOptions>(GetTransientPackage(), NAME_None, RF_Transient);
+			PrintOptions->PrintScope = PrintScope;
+			PrintOptions->ExportMethod = UPrintWidgetOptions::EExportMethod::ImageFile;
+			PrintOptions->SearchTarget = SearchTarget;
+
+			return PrintOptions;
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPrintJobQueueMergeTest,
+	"GraphPrinter.WidgetPrinter.PrintJobQueue.Merge",
+#if UE_5_05_OR_LATER
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter
+#else
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter
+#endif
+)
+
+bool FPrintJobQueueMergeTest::RunTest(const FString& Parameters)
+{
+	using namespace GraphPrinter;
+
+	// The widget is wrapped so that the same widget is found from the different search targets.
+	const TSharedRef<STextBlock> Widget = SNew(STextBlock);
+	const TSharedRef<SBox> Container = SNew(SBox)[Widget];
+	const TSharedRef<STextBlock> OtherWidget = SNew(STextBlock);
+
+	UPrintWidgetOptions* ContainerOptions = PrintJobQueueTest::MakePrintOptions(Container);
+	UPrintWidgetOptions* WidgetOptions = PrintJobQueueTest::MakePrintOptions(Widget);
+	UPrintWidgetOptions* OtherWidgetOptions = PrintJobQueueTest::MakePrintOptions(OtherWidget);
+	UPrintWidgetOptions* SelectedScopeOptions = PrintJobQueueTest::MakePrintOptions(Widget, UPrintWidgetOptions::EPrintScope::Selected);
+	UPrintWidgetOptions* UnprintableOptions = PrintJobQueueTest::MakePrintOptions(nullptr);
+
+	// Uses its own queue so that the jobs of the running editor are not affected and nothing is printed since it is never ticked.
+	const TSharedRef<PrintJobQueueTest::FTestPrintJobQueue> PrintJobQueue = MakeShared<PrintJobQueueTest::FTestPrintJobQueue>();
+	const int32 JobId = PrintJobQueue->Submit(ContainerOptions, EPrintJobPriority::Interactive);
+	const int32 SameWidgetJobId = PrintJobQueue->Submit(WidgetOptions, EPrintJobPriority::Interactive);
+	const int32 OtherWidgetJobId = PrintJobQueue->Submit(OtherWidgetOptions, EPrintJobPriority::Interactive);
+	const int32 SelectedScopeJobId = PrintJobQueue->Submit(SelectedScopeOptions, EPrintJobPriority::Interactive);
+	const int32 UnprintableJobId = PrintJobQueue->Submit(UnprintableOptions, EPrintJobPriority::Interactive);
+	const int32 OtherUnprintableJobId = PrintJobQueue->Submit(UnprintableOptions, EPrintJobPriority::Interactive);
+
+	TestEqual(TEXT("The request for the same widget from a different search target is merged"), SameWidgetJobId, JobId);
+	TestNotEqual(TEXT("The request for another widget is not merged"), OtherWidgetJobId, JobId);
+	TestNotEqual(TEXT("The request with another print scope is not merged"), SelectedScopeJobId, JobId);
+	TestNotEqual(TEXT("The requests for which no widget is found are not merged"), OtherUnprintableJobId, UnprintableJobId);
+
+	const TOptional<FPrintJobProgress> Progress = PrintJobQueue->GetProgress(JobId);
+	if (TestTrue(TEXT("The merged job is waiting"), Progress.IsSet()))
+	{
+		TestEqual(TEXT("The merged job prints the widget only once"), Progress->NumWidgets, 1);
+	}
+
+	PrintJobQueue->Cancel(JobId);
+
+	// The cancelled job is completed, so a new request is not merged into it.
+	const int32 NewJobId = PrintJobQueue->Submit(WidgetOptions, EPrintJobPriority::Interactive);
+	TestNotEqual(TEXT("The request after the cancellation is not merged"), NewJobId, JobId);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,135 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "ImageWriteTypes.h"
+#include "WidgetPrinter/ImageWriters/StreamingImageWriter.h"
+#include "GraphPrinterGlobals/GraphPrinterGlobals.h"
+#ifdef WITH_TEXT_CHUNK_HELPER
+#include "TextChunkHelper/ITextChunkHelper.h"
+#endif
+
+#if WITH_DEV_AUTOMATION_TESTS && defined(WITH_TEXT_CHUNK_HELPER)
+
+namespace GraphPrinter
+{
+	namespace StreamingPngImageWriterTest
+	{
+		// The size of the test image.
+		static const FIntPoint ImageSize = FIntPoint(64, 48);
+
+		// The number of rows written at a time.
+		static constexpr int32 RowsPerWrite = 16;
+
+		// Reads the value written in big endian.
+		uint32 ReadUint32(const uint8* Source)
+		{
+			return (static_cast<uint32>(Source[0]) << 24) | (static_cast<uint32>(Source[1]) << 16) | (static_cast<uint32>(Source[2]) << 8) | Source[3];
+		}
+
+		// Returns the types of the chunks in the png file in order.
+		TArray<FString> GetChunkTypes(const TArray<uint8>& PngData)
+		{
+			TArray<FString> ChunkTypes;
+			int64 Offset = 8;
+			while (Offset + 12 <= PngData.Num())
+			{
+				const uint32 DataSize = ReadUint32(PngData.GetData() + Offset);
+				const ANSICHAR* Type = reinterpret_cast<const ANSICHAR*>(PngData.GetData() + Offset + 4);
+				ChunkTypes.Add(FString(4, Type));
+				Offset += 12 + static_cast<int64>(DataSize);
+			}
+			return ChunkTypes;
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FStreamingPngImageWriterTextChunksTest,
+	"GraphPrinter.WidgetPrinter.StreamingPngImageWriter.TextChunks",
+#if UE_5_05_OR_LATER
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter
+#else
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter
+#endif
+)
+
+bool FStreamingPngImageWriterTextChunksTest::RunTest(const FString& Parameters)
+{
+	using namespace GraphPrinter;
+
+	const FString OutputDirectory = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("GraphPrinter"), TEXT("StreamingPngImageWriter"));
+	IFileManager::Get().DeleteDirectory(*OutputDirectory, false, true);
+	IFileManager::Get().MakeDirectory(*OutputDirectory, true);
+	const FString Filename = FPaths::Combine(OutputDirectory, TEXT("Graph.png"));
+
+	TMap<FString, FString> MapToWrite;
+	MapToWrite.Add(TEXT("Ascii"), TEXT("Begin Object Class=/Script/BlueprintGraph.K2Node_CallFunction Name=\"K2Node_CallFunction_0\""));
+	MapToWrite.Add(TEXT("Unicode"), TEXT("\u30B0\u30E9\u30D5"));
+
+	TextChunkHelper::ITextChunkHelper& TextChunkHelper = TextChunkHelper::ITextChunkHelper::Get();
+	TArray<uint8> EncodedTextChunks;
+	if (!TestTrue(TEXT("Encoded the text chunks"), TextChunkHelper.EncodeTextChunks(EDesiredImageFormat::PNG, MapToWrite, TextChunkHelper::ETextChunkFormat::Compressed, EncodedTextChunks)))
+	{
+		return true;
+	}
+
+	TArray<FColor> Pixels;
+	Pixels.Init(FColor(12, 34, 56, 255), StreamingPngImageWriterTest::ImageSize.X * StreamingPngImageWriterTest::ImageSize.Y);
+
+	const TSharedPtr<IStreamingImageWriter> StreamingImageWriter = IStreamingImageWriter::Create(EDesiredImageFormat::PNG);
+	if (!TestTrue(TEXT("Created the streaming image writer"), StreamingImageWriter.IsValid()) ||
+		!TestTrue(TEXT("Opened the image file"), StreamingImageWriter->Open(Filename, StreamingPngImageWriterTest::ImageSize, 0, true, EncodedTextChunks)))
+	{
+		return true;
+	}
+
+	bool bIsWritten = true;
+	for (int32 StartRow = 0; StartRow < StreamingPngImageWriterTest::ImageSize.Y && bIsWritten; StartRow += StreamingPngImageWriterTest::RowsPerWrite)
+	{
+		bIsWritten = StreamingImageWriter->WriteRows(Pixels.GetData() + StartRow * StreamingPngImageWriterTest::ImageSize.X, StreamingPngImageWriterTest::RowsPerWrite);
+	}
+	if (!TestTrue(TEXT("Wrote the rows"), bIsWritten) ||
+		!TestTrue(TEXT("Closed the image file"), StreamingImageWriter->Close()))
+	{
+		return true;
+	}
+
+	// The text chunks are written between the header and the image data.
+	TArray<uint8> PngData;
+	if (TestTrue(TEXT("Loaded the image file"), FFileHelper::LoadFileToArray(PngData, *Filename)))
+	{
+		const TArray<FString> ChunkTypes = StreamingPngImageWriterTest::GetChunkTypes(PngData);
+		const int32 FirstImageDataIndex = ChunkTypes.IndexOfByKey(TEXT("IDAT"));
+		const int32 LastTextChunkIndex = ChunkTypes.FindLastByPredicate(
+			[](const FString& ChunkType) -> bool
+			{
+				return (ChunkType == TEXT("tEXt") || ChunkType == TEXT("zTXt") || ChunkType == TEXT("iTXt"));
+			}
+		);
+		TestEqual(TEXT("The first chunk is the header"), ChunkTypes.IsValidIndex(0) ? ChunkTypes[0] : FString(), FString(TEXT("IHDR")));
+		TestTrue(TEXT("The text chunks are written"), LastTextChunkIndex != INDEX_NONE);
+		TestTrue(TEXT("The text chunks come before the image data"), FirstImageDataIndex != INDEX_NONE && LastTextChunkIndex < FirstImageDataIndex);
+	}
+
+	const TSharedPtr<TextChunkHelper::ITextChunk> TextChunk = TextChunkHelper.CreateTextChunk(Filename, TextChunkHelper::ETextChunkOpenMode::ReadOnly);
+	TMap<FString, FString> MapToRead;
+	if (TestTrue(TEXT("Read the text chunks"), TextChunk.IsValid() && TextChunk->Read(MapToRead)))
+	{
+		TestEqual(TEXT("The number of the text chunks"), MapToRead.Num(), MapToWrite.Num());
+		for (const auto& Pair : MapToWrite)
+		{
+			const FString* Value = MapToRead.Find(Pair.Key);
+			TestTrue(FString::Printf(TEXT("The text of %s"), *Pair.Key), Value != nullptr && Value->Equals(Pair.Value, ESearchCase::CaseSensitive));
+		}
+	}
+
+	IFileManager::Get().DeleteDirectory(*OutputDirectory, false, true);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,11 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#include "WidgetPrinter/Types/PrintJobProgress.h"
+
+namespace GraphPrinter
+{
+	bool FPrintJobProgress::IsCompleted() const
+	{
+		return (State == EPrintJobState::Finished || State == EPrintJobState::Cancelled);
+	}
+}
@@ -18,11 +18,17 @@ UPrintWidgetOptions::UPrintWidgetOptions()
 	, ExportMethod(EExportMethod::ImageFile)
 #ifdef WITH_TEXT_CHUNK_HELPER
 	, bIsIncludeWidgetInfoInImageFile(true)
+	, WidgetInfoFormat(EWidgetInfoFormat::Uncompressed)
 #endif
 	, bUseGamma(true)
 	, MaxImageSize(FVector2D::ZeroVector)
 	, RenderingScale(1.f)
+	, bEnableTiledRendering(false)
+	, TileSize(2048)
+	, bUseAsyncReadback(false)
 	, FilteringMode(TF_Default)
+	, PngColorReduction(EPngColorReduction::None)
+	, bSkipUnchangedExport(false)
 	, SearchTarget(nullptr)
 {
 	ImageWriteOptions.bAsync = true;
@@ -39,14 +45,41 @@ UPrintWidgetOptions* UPrintWidgetOptions::Duplicate(const TSubclassOf<UPrintWidg
 		Destination->PrintScope = PrintScope;
 		Destination->ExportMethod = ExportMethod;
 		Destination->bIsIncludeWidgetInfoInImageFile = bIsIncludeWidgetInfoInImageFile;
+		Destination->WidgetInfoFormat = WidgetInfoFormat;
 		Destination->bUseGamma = bUseGamma;
 		Destination->MaxImageSize = MaxImageSize;
 		Destination->RenderingScale = RenderingScale;
+		Destination->bEnableTiledRendering = bEnableTiledRendering;
+		Destination->TileSize = TileSize;
+		Destination->bUseAsyncReadback = bUseAsyncReadback;
 		Destination->FilteringMode = FilteringMode;
 		Destination->ImageWriteOptions = ImageWriteOptions;
+		Destination->PngColorReduction = PngColorReduction;
+		Destination->bSkipUnchangedExport = bSkipUnchangedExport;
 		Destination->OutputDirectoryPath = OutputDirectoryPath;
 		Destination->SearchTarget = SearchTarget;
 	}
 
 	return Destination;
 }
+
+FString UPrintWidgetOptions::GetContentHashText() const
+{
+	// The options that only affect how the image is output, such as whether to read back asynchronously, are not included.
+	FString Text;
+	Text += FString::Printf(TEXT("PrintScope=%d\n"), static_cast<int32>(PrintScope));
+#ifdef WITH_TEXT_CHUNK_HELPER
+	Text += FString::Printf(TEXT("bIsIncludeWidgetInfoInImageFile=%d\n"), bIsIncludeWidgetInfoInImageFile ? 1 : 0);
+	Text += FString::Printf(TEXT("WidgetInfoFormat=%d\n"), static_cast<int32>(WidgetInfoFormat));
+#endif
+	Text += FString::Printf(TEXT("bUseGamma=%d\n"), bUseGamma ? 1 : 0);
+	Text += FString::Printf(TEXT("MaxImageSize=%s\n"), *MaxImageSize.ToString());
+	Text += FString::Printf(TEXT("RenderingScale=%f\n"), RenderingScale);
+	Text += FString::Printf(TEXT("bEnableTiledRendering=%d\n"), bEnableTiledRendering ? 1 : 0);
+	Text += FString::Printf(TEXT("TileSize=%d\n"), TileSize);
+	Text += FString::Printf(TEXT("FilteringMode=%d\n"), static_cast<int32>(FilteringMode));
+	Text += FString::Printf(TEXT("Format=%d\n"), static_cast<int32>(ImageWriteOptions.Format));
+	Text += FString::Printf(TEXT("CompressionQuality=%d\n"), ImageWriteOptions.CompressionQuality);
+	Text += FString::Printf(TEXT("PngColorReduction=%d\n"), static_cast<int32>(PngColorReduction));
+	return Text;
+}
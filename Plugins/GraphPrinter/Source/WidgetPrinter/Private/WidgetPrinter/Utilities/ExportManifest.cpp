@@ -0,0 +1,210 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#include "WidgetPrinter/Utilities/ExportManifest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "HAL/FileManager.h"
+
+namespace GraphPrinter
+{
+	namespace ExportManifest
+	{
+		// The name of the manifest file written in each output directory.
+		static const FString ManifestFilename = TEXT("GraphPrinterManifest.txt");
+
+		// The first line of the manifest file.
+		// If the format of the manifest or the hashed content changes, changing this discards the existing manifests.
+		static const FString ManifestHeader = TEXT("# GraphPrinter Export Manifest 2");
+
+		// The character that separates the key, the hash and the file name in each line.
+		static const TCHAR* Separator = TEXT("\t");
+
+		// The interval to write the modified manifests.
+		static constexpr float FlushInterval = 1.f;
+	}
+
+	FExportManifest::FExportManifest()
+	{
+#if UE_5_00_OR_LATER
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+#else
+		TickerHandle = FTicker::GetCoreTicker().AddTicker(
+#endif
+			FTickerDelegate::CreateRaw(this, &FExportManifest::HandleOnTick),
+			ExportManifest::FlushInterval
+		);
+	}
+
+	FExportManifest::~FExportManifest()
+	{
+#if UE_5_00_OR_LATER
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+#else
+		FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+#endif
+
+		Flush();
+	}
+
+	bool FExportManifest::FindUpToDateFile(const FString& OutputDirectoryPath, const FString& Key, const FString& Hash, FString& OutFilename)
+	{
+		const FString DirectoryPath = NormalizeDirectoryPath(OutputDirectoryPath);
+		const FManifestFile& ManifestFile = FindOrLoadManifestFile(DirectoryPath);
+
+		const FEntry* Entry = ManifestFile.Entries.Find(Key);
+		if (Entry == nullptr || Entry->Hash != Hash)
+		{
+			return false;
+		}
+
+		// If the image file has been deleted or moved, it needs to be printed again.
+		const FString Filename = FPaths::Combine(DirectoryPath, Entry->Filename);
+		if (!IFileManager::Get().FileExists(*Filename))
+		{
+			return false;
+		}
+
+		OutFilename = Filename;
+		return true;
+	}
+
+	void FExportManifest::Record(const FString& Filename, const FString& Key, const FString& Hash)
+	{
+		FManifestFile& ManifestFile = FindOrLoadManifestFile(NormalizeDirectoryPath(FPaths::GetPath(Filename)));
+
+		FEntry& Entry = ManifestFile.Entries.FindOrAdd(Key);
+		Entry.Hash = Hash;
+		Entry.Filename = FPaths::GetCleanFilename(Filename);
+		ManifestFile.bIsDirty = true;
+	}
+
+	void FExportManifest::Flush()
+	{
+		for (auto& Pair : ManifestFiles)
+		{
+			FManifestFile& ManifestFile = Pair.Value;
+			if (!ManifestFile.bIsDirty)
+			{
+				continue;
+			}
+
+			TArray<FString> Lines;
+			Lines.Reserve(ManifestFile.Entries.Num() + 1);
+			Lines.Add(ExportManifest::ManifestHeader);
+			for (const auto& EntryPair : ManifestFile.Entries)
+			{
+				Lines.Add(FString::Join(TArray<FString>{ EntryPair.Key, EntryPair.Value.Hash, EntryPair.Value.Filename }, ExportManifest::Separator));
+			}
+
+			// Sorts so that the manifest file does not change when the entries have not changed.
+			Lines.Sort();
+
+			const FString ManifestFilename = GetManifestFilename(Pair.Key);
+			if (!FFileHelper::SaveStringArrayToFile(Lines, *ManifestFilename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+			{
+				UE_LOG(LogGraphPrinter, Warning, TEXT("Failed to write the export manifest : %s"), *ManifestFilename);
+				continue;
+			}
+
+			ManifestFile.bIsDirty = false;
+		}
+	}
+
+	FString FExportManifest::CalculateHash(const FString& Text)
+	{
+		// Hashes the UTF-8 bytes so that the hash does not depend on the size of TCHAR on each platform.
+		const FTCHARToUTF8 Utf8Text(*Text);
+		FSHAHash Hash;
+		FSHA1::HashBuffer(Utf8Text.Get(), Utf8Text.Length(), Hash.Hash);
+		return Hash.ToString();
+	}
+
+	FExportManifest::FManifestFile& FExportManifest::FindOrLoadManifestFile(const FString& OutputDirectoryPath)
+	{
+		if (FManifestFile* ManifestFile = ManifestFiles.Find(OutputDirectoryPath))
+		{
+			return *ManifestFile;
+		}
+
+		FManifestFile& ManifestFile = ManifestFiles.Add(OutputDirectoryPath);
+
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadFileToStringArray(Lines, *GetManifestFilename(OutputDirectoryPath)))
+		{
+			return ManifestFile;
+		}
+
+		// The manifest written in a different format is treated as if there were no exported image files.
+		if (!Lines.Contains(ExportManifest::ManifestHeader))
+		{
+			return ManifestFile;
+		}
+
+		for (const FString& Line : Lines)
+		{
+			if (Line.StartsWith(TEXT("#")))
+			{
+				continue;
+			}
+
+			TArray<FString> Fields;
+			Line.ParseIntoArray(Fields, ExportManifest::Separator, false);
+			if (Fields.Num() != 3)
+			{
+				continue;
+			}
+
+			FEntry& Entry = ManifestFile.Entries.FindOrAdd(Fields[0]);
+			Entry.Hash = Fields[1];
+			Entry.Filename = Fields[2];
+		}
+
+		return ManifestFile;
+	}
+
+	FString FExportManifest::GetManifestFilename(const FString& OutputDirectoryPath)
+	{
+		return FPaths::Combine(OutputDirectoryPath, ExportManifest::ManifestFilename);
+	}
+
+	FString FExportManifest::NormalizeDirectoryPath(const FString& OutputDirectoryPath)
+	{
+		FString DirectoryPath = FPaths::ConvertRelativePathToFull(OutputDirectoryPath);
+		FPaths::NormalizeDirectoryName(DirectoryPath);
+		return DirectoryPath;
+	}
+
+	bool FExportManifest::HandleOnTick(float DeltaTime)
+	{
+		Flush();
+		return true;
+	}
+
+	namespace ExportManifest
+	{
+		static TUniquePtr<FExportManifest> Instance;
+	}
+
+	void FExportManifest::Register()
+	{
+		ExportManifest::Instance = MakeUnique<FExportManifest>();
+	}
+
+	void FExportManifest::Unregister()
+	{
+		ExportManifest::Instance.Reset();
+	}
+
+	bool FExportManifest::IsAvailable()
+	{
+		return ExportManifest::Instance.IsValid();
+	}
+
+	FExportManifest& FExportManifest::Get()
+	{
+		// Don't call before Register is called or after Unregister is called.
+		check(ExportManifest::Instance.IsValid());
+		return *ExportManifest::Instance.Get();
+	}
+}
@@ -19,13 +19,23 @@
 #define LOCTEXT_NAMESPACE "WidgetPrinterSettings"
 
 UWidgetPrinterSettings::UWidgetPrinterSettings()
-	: Format(EDesiredImageFormat::PNG)
+	: WidgetInfoFormat(EWidgetInfoFormat::Uncompressed)
+	, Format(EDesiredImageFormat::PNG)
 	, CompressionQuality(0)
+	, PngColorReduction(EPngColorReduction::None)
 	, FilteringMode(TF_Default)
 	, bUseGamma(true)
 	, MaxImageSize(15000.f, 15000.f)
 	, RenderingScale(1.f)
+	, bEnableTiledRendering(false)
+	, TileSize(2048)
+	, bUseAsyncReadback(false)
+	, MaxConcurrentBatchPrints(3)
+	, RenderTargetPoolMaxMemoryMB(512)
+	, RenderTargetPoolIdleTimeout(30.f)
+	, SupportedWidgetCollectionTimeBudget(2.f)
 	, bCanOverwriteFileWhenExport(false)
+	, bSkipUnchangedExport(false)
 {
 #ifdef WITH_TEXT_CHUNK_HELPER
 	bIsIncludeWidgetInfoInImageFile = true;
@@ -96,12 +106,28 @@ bool UWidgetPrinterSettings::CanEditChange(const UProperty* InProperty) const
 {
 	if (InProperty != nullptr)
 	{
-		if (InProperty->GetFName() == GET_MEMBER_NAME_CHECKED(UWidgetPrinterSettings, bIsIncludeWidgetInfoInImageFile))
+		if (InProperty->GetFName() == GET_MEMBER_NAME_CHECKED(UWidgetPrinterSettings, bIsIncludeWidgetInfoInImageFile) ||
+			InProperty->GetFName() == GET_MEMBER_NAME_CHECKED(UWidgetPrinterSettings, WidgetInfoFormat))
 		{
 #ifndef WITH_TEXT_CHUNK_HELPER
 			return false;
 #endif
 		}
+
+		if (InProperty->GetFName() == GET_MEMBER_NAME_CHECKED(UWidgetPrinterSettings, bUseAsyncReadback))
+		{
+#if !UE_5_01_OR_LATER
+			return false;
+#endif
+		}
+
+		if (InProperty->GetFName() == GET_MEMBER_NAME_CHECKED(UWidgetPrinterSettings, PngColorReduction))
+		{
+			if (Format != EDesiredImageFormat::PNG)
+			{
+				return false;
+			}
+		}
 	}
 	
 	return Super::CanEditChange(InProperty);
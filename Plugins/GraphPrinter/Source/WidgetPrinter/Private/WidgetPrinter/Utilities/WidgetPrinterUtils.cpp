@@ -10,9 +10,10 @@
 
 namespace GraphPrinter
 {
-	void FWidgetPrinterUtils::EnumerateChildWidgets(
+	void FWidgetPrinterUtils::WalkWidgetTree(
 		const TSharedPtr<SWidget>& SearchTarget,
-		const TFunction<bool(const TSharedPtr<SWidget>& ChildWidget)>& Predicate
+		const TFunctionRef<EWidgetWalkResult(SWidget& Widget, const int32 Depth)>& Visitor,
+		const int32 MaxDepth
 	)
 	{
 		if (!SearchTarget.IsValid())
@@ -20,23 +21,126 @@ namespace GraphPrinter
 			return;
 		}
 
-		FChildren* Children = SearchTarget->GetChildren();
-		if (Children == nullptr)
+		// Holds raw pointers without touching the reference count since SearchTarget keeps its children alive while walking.
+		TArray<TPair<SWidget*, int32>, TInlineAllocator<64>> WidgetStack;
+		WidgetStack.Emplace(SearchTarget.Get(), 0);
+		
+		while (WidgetStack.Num() > 0)
 		{
-			return;
+			const TPair<SWidget*, int32> Current = WidgetStack.Pop();
+			SWidget& Widget = *Current.Key;
+			const int32 Depth = Current.Value;
+
+			const EWidgetWalkResult Result = Visitor(Widget, Depth);
+			if (Result == EWidgetWalkResult::Stop)
+			{
+				return;
+			}
+			if (Result == EWidgetWalkResult::SkipChildren)
+			{
+				continue;
+			}
+			
+			if (MaxDepth != INDEX_NONE && Depth >= MaxDepth)
+			{
+				continue;
+			}
+
+			FChildren* Children = Widget.GetChildren();
+			if (Children == nullptr)
+			{
+				continue;
+			}
+
+			// Pushes the children in reverse order so that they are visited in the same order as they are arranged.
+			for (int32 Index = Children->Num() - 1; Index >= 0; Index--)
+			{
+				WidgetStack.Emplace(&Children->GetChildAt(Index).Get(), Depth + 1);
+			}
 		}
+	}
 
-		for (int32 Index = 0; Index < Children->Num(); Index++)
+	void FWidgetPrinterUtils::FindNearestChildWidgets(
+		const TSharedPtr<SWidget>& SearchTarget,
+		const TArray<FName>& TypeNames,
+		TArray<TSharedPtr<SWidget>>& OutFoundWidgets,
+		const int32 MaxDepth
+	)
+	{
+		OutFoundWidgets.Reset(TypeNames.Num());
+		OutFoundWidgets.SetNum(TypeNames.Num());
+		
+		int32 NumRemainingTypes = TypeNames.Num();
+		if (NumRemainingTypes == 0)
 		{
-			TSharedPtr<SWidget> ChildWidget = Children->GetChildAt(Index);
-			if (ChildWidget.IsValid())
+			return;
+		}
+		
+		WalkWidgetTree(
+			SearchTarget,
+			[&](SWidget& Widget, const int32 Depth) -> EWidgetWalkResult
 			{
-				if (Predicate(ChildWidget))
+				const FName WidgetType = Widget.GetType();
+				for (int32 Index = 0; Index < TypeNames.Num(); Index++)
 				{
-					EnumerateChildWidgets(ChildWidget, Predicate);
+					if (!OutFoundWidgets[Index].IsValid() && TypeNames[Index] == WidgetType)
+					{
+						OutFoundWidgets[Index] = Widget.AsShared();
+						NumRemainingTypes--;
+					}
 				}
+
+				// Continues to search inside the found widget as other types may be found there.
+				return ((NumRemainingTypes > 0) ? EWidgetWalkResult::Continue : EWidgetWalkResult::Stop);
+			},
+			MaxDepth
+		);
+	}
+
+	TSharedPtr<SWidget> FWidgetPrinterUtils::FindNearestChildWidget(
+		const TSharedPtr<SWidget>& SearchTarget,
+		const FName& TypeName,
+		const int32 MaxDepth
+	)
+	{
+		TSharedPtr<SWidget> FoundWidget = nullptr;
+		
+		WalkWidgetTree(
+			SearchTarget,
+			[&](SWidget& Widget, const int32 Depth) -> EWidgetWalkResult
+			{
+				if (Widget.GetType() == TypeName)
+				{
+					FoundWidget = Widget.AsShared();
+					return EWidgetWalkResult::Stop;
+				}
+
+				return EWidgetWalkResult::Continue;
+			},
+			MaxDepth
+		);
+
+		return FoundWidget;
+	}
+	
+	void FWidgetPrinterUtils::EnumerateChildWidgets(
+		const TSharedPtr<SWidget>& SearchTarget,
+		const TFunction<bool(const TSharedPtr<SWidget>& ChildWidget)>& Predicate
+	)
+	{
+		WalkWidgetTree(
+			SearchTarget,
+			[&](SWidget& Widget, const int32 Depth) -> EWidgetWalkResult
+			{
+				// SearchTarget itself is not passed to the predicate.
+				if (Depth == 0)
+				{
+					return EWidgetWalkResult::Continue;
+				}
+				
+				return (Predicate(Widget.AsShared()) ? EWidgetWalkResult::Continue : EWidgetWalkResult::SkipChildren);
 			}
-		}
+		);
 	}
 
 	void FWidgetPrinterUtils::EnumerateParentWidgets(
@@ -48,16 +152,16 @@ namespace GraphPrinter
 		{
 			return;
 		}
-			
-		const TSharedPtr<SWidget> ParentWidget = SearchTarget->GetParentWidget();
-		if (!ParentWidget.IsValid())
-		{
-			return;
-		}
 
-		if (Predicate(ParentWidget))
+		TSharedPtr<SWidget> ParentWidget = SearchTarget->GetParentWidget();
+		while (ParentWidget.IsValid())
 		{
-			EnumerateParentWidgets(ParentWidget, Predicate);
+			if (!Predicate(ParentWidget))
+			{
+				return;
+			}
+			
+			ParentWidget = ParentWidget->GetParentWidget();
 		}
 	}
 
@@ -111,26 +215,7 @@ namespace GraphPrinter
 	
 	TSharedPtr<SOverlay> FWidgetPrinterUtils::FindNearestChildOverlay(const TSharedPtr<SWidget>& SearchTarget)
 	{
-		TSharedPtr<SOverlay> FoundOverlay = GP_CAST_SLATE_WIDGET(SOverlay, SearchTarget);
-		if (!FoundOverlay.IsValid())
-		{
-			EnumerateChildWidgets(
-				SearchTarget,
-				[&FoundOverlay](const TSharedPtr<SWidget>& ChildWidget) -> bool
-				{
-					const TSharedPtr<SOverlay> Overlay = GP_CAST_SLATE_WIDGET(SOverlay, ChildWidget);
-					if (Overlay.IsValid())
-					{
-						FoundOverlay = Overlay;
-						return false;
-					}
-
-					return true;
-				}
-			);
-		}
-
-		return FoundOverlay;
+		return StaticCastSharedPtr<SOverlay>(FindNearestChildWidget(SearchTarget, GP_SLATE_WIDGET_TYPE_NAME(SOverlay)));
 	}
 
 	TSharedPtr<SWidget> FWidgetPrinterUtils::GetMostSuitableSearchTarget()
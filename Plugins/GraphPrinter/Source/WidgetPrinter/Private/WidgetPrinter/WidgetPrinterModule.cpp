@@ -4,6 +4,9 @@
 #include "Modules/ModuleManager.h"
 #include "WidgetPrinter/IWidgetPrinterRegistry.h"
 #include "WidgetPrinter/ISupportedWidgetRegistry.h"
+#include "WidgetPrinter/IPrintJobQueue.h"
+#include "WidgetPrinter/Rendering/WidgetRenderTargetPool.h"
+#include "WidgetPrinter/Utilities/ExportManifest.h"
 
 namespace GraphPrinter
 {
@@ -23,10 +26,28 @@ namespace GraphPrinter
 
 		// Registers supported widget registry.
 		ISupportedWidgetRegistry::Register();
+
+		// Registers print job queue.
+		IPrintJobQueue::Register();
+
+		// Registers render target pool.
+		FWidgetRenderTargetPool::Register();
+
+		// Registers export manifest.
+		FExportManifest::Register();
 	}
 
 	void FWidgetPrinterModule::ShutdownModule()
 	{
+		// Unregisters export manifest.
+		FExportManifest::Unregister();
+		
+		// Unregisters render target pool.
+		FWidgetRenderTargetPool::Unregister();
+		
+		// Unregisters print job queue.
+		IPrintJobQueue::Unregister();
+		
 		// Unregisters supported widget registry.
 		ISupportedWidgetRegistry::Unregister();
 		
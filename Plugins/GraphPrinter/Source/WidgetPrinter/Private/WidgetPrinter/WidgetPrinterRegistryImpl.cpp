@@ -2,18 +2,33 @@
 
 #include "WidgetPrinter/IWidgetPrinterRegistry.h"
 #include "WidgetPrinter/Types/SupportedWidget.h"
+#include "WidgetPrinter/IPrintJobQueue.h"
 #include "GraphPrinterGlobals/GraphPrinterGlobals.h"
 #include "Interfaces/IMainFrameModule.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Framework/Docking/TabManager.h"
 #include "UObject/Class.h"
 #include "UObject/UObjectIterator.h"
 #include "UObject/Package.h"
 #include "Templates/SubclassOf.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Misc/CoreDelegates.h"
 #if !UE_5_00_OR_LATER
 #include "Misc/HotReloadInterface.h"
 #endif
 
 namespace GraphPrinter
 {
+	namespace WidgetPrinterRegistryInternal
+	{
+		// Returns whether the printer found under the specified conditions depends only on the search target.
+		// The printer that can print the selected area depends on the selection in the widget, which may change without moving the focus.
+		bool CanCacheResolution(const TSharedPtr<SWidget>& SearchTarget, const UPrintWidgetOptions::EPrintScope PrintScope)
+		{
+			return (SearchTarget.IsValid() && PrintScope != UPrintWidgetOptions::EPrintScope::Selected);
+		}
+	}
+	
 	class FWidgetPrinterRegistryImpl : public IWidgetPrinterRegistry
 	{
 	public:
@@ -26,12 +41,17 @@ namespace GraphPrinter
 		// IWidgetPrinterRegistry interface.
 		virtual UWidgetPrinter* FindAvailableWidgetPrinter(UPrintWidgetOptions*  Options) const override;
 		virtual UWidgetPrinter* FindAvailableWidgetPrinter(URestoreWidgetOptions* Options) const override;
+		virtual void PrintWidgets(const TArray<UPrintWidgetOptions*>& OptionsList, const FOnPrintWidgetsFinished& OnFinished) override;
 		virtual TOptional<FSupportedWidget> CheckIfSupported(const TSharedRef<SWidget>& TestWidget) const override;
+		virtual void CollectWidgetPrinters() override;
 		// End of IWidgetPrinterRegistry interface.
 	
 	private:
 		// Called when the editor mainframe has been created.
 		void HandleOnMainFrameCreationFinished(TSharedPtr<SWindow> InRootWindow, bool bIsNewProjectWindow);
+
+		// Called when the engine has been initialized.
+		void HandleOnPostEngineInit();
 		
 		// Called when the hot reload is complete.
 #if UE_5_00_OR_LATER
@@ -40,15 +60,103 @@ namespace GraphPrinter
 		void HandleOnHotReload(bool bWasTriggeredAutomatically);
 #endif
 		
-		// Collects instances of inherited classes of all existing UWidgetPrinter class.
-		void CollectWidgetPrinters();
+		// Called when the focused widget or the active tab is changed.
+		void HandleOnFocusChanging(
+			const FFocusEvent& FocusEvent,
+			const FWeakWidgetPath& OldFocusedWidgetPath,
+			const TSharedPtr<SWidget>& OldFocusedWidget,
+			const FWidgetPath& NewFocusedWidgetPath,
+			const TSharedPtr<SWidget>& NewFocusedWidget
+		);
+		void HandleOnActiveTabChanged(TSharedPtr<SDockTab> PreviouslyActive, TSharedPtr<SDockTab> NewlyActivated);
+		
+		// Returns the printer classes checked against the specified widget when collecting the supported widgets, in order of priority.
+		// The widgets of the types that no printer declares are only checked against the printers that don't declare the type.
+		const TArray<TSubclassOf<UWidgetPrinter>>& GetCandidateWidgetPrinterClasses(const TSharedRef<SWidget>& Widget) const;
+
+		// Builds the printer classes checked against the widgets of each declared type from the sorted printer classes.
+		void BuildCandidateWidgetPrinterClassesByType();
+
+		// Returns the printer class that was found in the past for the same search target with the same options class and conditions.
+		// Returns false if there is no valid result.
+		bool FindCachedResolution(
+			const TSharedPtr<SWidget>& SearchTarget,
+			const UClass* OptionsClass,
+			const UPrintWidgetOptions::EPrintScope PrintScope,
+			const UPrintWidgetOptions::EExportMethod ExportMethod,
+			TSubclassOf<UWidgetPrinter>& OutPrinterClass
+		) const;
+
+		// Stores the printer class found under the specified conditions.
+		void AddCachedResolution(
+			const TSharedPtr<SWidget>& SearchTarget,
+			const UClass* OptionsClass,
+			const UPrintWidgetOptions::EPrintScope PrintScope,
+			const UPrintWidgetOptions::EExportMethod ExportMethod,
+			const TSubclassOf<UWidgetPrinter>& PrinterClass
+		) const;
+
+		// Discards the result of searching for the printer under the specified conditions.
+		void RemoveCachedResolution(
+			const TSharedPtr<SWidget>& SearchTarget,
+			const UClass* OptionsClass,
+			const UPrintWidgetOptions::EPrintScope PrintScope,
+			const UPrintWidgetOptions::EExportMethod ExportMethod
+		) const;
+
+		// Returns an instance of the printer class that is not in use.
+		UWidgetPrinter* GetPrinterInstance(const TSubclassOf<UWidgetPrinter>& PrinterClass) const;
+
+		// Binds the events that discard the results of searching for the printer if Slate is ready.
+		void BindInvalidationEvents();
+
+		// Discards all results of searching for the printer.
+		void InvalidateResolutionCache();
 		
 	private:
 		// The list of all existing classes that inherits from UWidgetPrinters.
 		TArray<TSubclassOf<UWidgetPrinter>> WidgetPrinterClasses;
+
+		// The printer classes checked against the widgets of each type declared by either printer, in order of priority.
+		// It is rebuilt whenever the printer classes are collected.
+		TMap<FName, TArray<TSubclassOf<UWidgetPrinter>>> CandidateWidgetPrinterClassesByType;
+
+		// The list of printer classes that don't declare the type of the widget they handle.
+		TArray<TSubclassOf<UWidgetPrinter>> UntypedWidgetPrinterClasses;
+
+		// The result of searching for the printer under specific conditions.
+		// It is kept until the printer classes are collected again or the focus moves, and is discarded when the search target is destroyed.
+		struct FResolutionCacheEntry
+		{
+		public:
+			// The widget that was the starting point for searching for the widget to print.
+			TWeakPtr<SWidget> SearchTarget;
+
+			// The class of the options used for the search.
+			TWeakObjectPtr<const UClass> OptionsClass;
+
+			// The conditions of the search.
+			UPrintWidgetOptions::EPrintScope PrintScope;
+			UPrintWidgetOptions::EExportMethod ExportMethod;
+
+			// The printer class found.
+			TSubclassOf<UWidgetPrinter> PrinterClass;
+		};
+		mutable TArray<FResolutionCacheEntry> ResolutionCache;
+
+		// The printer instances that are reused instead of creating new ones every time.
+		// While a printer is printing, for example in batch printing, another instance of the same class is added.
+		mutable TMap<UClass*, TArray<TStrongObjectPtr<UWidgetPrinter>>> PrinterInstances;
+
+		// The handle of the event called when the active tab is changed.
+		FDelegateHandle OnActiveTabChangedHandle;
+
+		// Whether the event called when the focused widget is changed has been bound.
+		bool bIsFocusChangingBound;
 	};
 
 	FWidgetPrinterRegistryImpl::FWidgetPrinterRegistryImpl()
+		: bIsFocusChangingBound(false)
 	{
 		// Collects widget printers and try to recollect them at hot reload.
 		IMainFrameModule::Get().OnMainFrameCreationFinished().AddRaw(this, &FWidgetPrinterRegistryImpl::HandleOnMainFrameCreationFinished);
@@ -59,6 +167,14 @@ namespace GraphPrinter
 		IHotReloadInterface& HotReloadInterface = FModuleManager::LoadModuleChecked<IHotReloadInterface>(TEXT("HotReload"));
 		HotReloadInterface.OnHotReload().AddRaw(this, &FWidgetPrinterRegistryImpl::HandleOnHotReload);
 #endif
+
+		// Since the state of the widget such as the object shown in a details panel usually changes when the focus moves, the results of searching for the printer are also discarded then.
+		// This is bound regardless of the mainframe so that the results are also discarded in commandlets.
+		BindInvalidationEvents();
+		if (!bIsFocusChangingBound)
+		{
+			FCoreDelegates::OnPostEngineInit.AddRaw(this, &FWidgetPrinterRegistryImpl::HandleOnPostEngineInit);
+		}
 	}
 
 	FWidgetPrinterRegistryImpl::~FWidgetPrinterRegistryImpl()
@@ -69,12 +185,35 @@ namespace GraphPrinter
 		IHotReloadInterface& HotReloadInterface = FModuleManager::LoadModuleChecked<IHotReloadInterface>(TEXT("HotReload"));
 		HotReloadInterface.OnHotReload().RemoveAll(this);
 #endif
+
+		FCoreDelegates::OnPostEngineInit.RemoveAll(this);
+		if (bIsFocusChangingBound && FSlateApplication::IsInitialized())
+		{
+			FSlateApplication::Get().OnFocusChanging().RemoveAll(this);
+		}
+		if (OnActiveTabChangedHandle.IsValid())
+		{
+			FGlobalTabmanager::Get()->OnActiveTabChanged_Unsubscribe(OnActiveTabChangedHandle);
+		}
 		
+		InvalidateResolutionCache();
+		PrinterInstances.Reset();
+		CandidateWidgetPrinterClassesByType.Reset();
+		UntypedWidgetPrinterClasses.Reset();
 		WidgetPrinterClasses.Reset();
 	}
 	
 	UWidgetPrinter* FWidgetPrinterRegistryImpl::FindAvailableWidgetPrinter(UPrintWidgetOptions* Options) const
 	{
+		check(IsValid(Options));
+		
+		TSubclassOf<UWidgetPrinter> CachedPrinterClass;
+		if (FindCachedResolution(Options->SearchTarget, Options->GetClass(), Options->PrintScope, Options->ExportMethod, CachedPrinterClass))
+		{
+			return GetPrinterInstance(CachedPrinterClass);
+		}
+		
+		// Since the printers look for the widget to print among the ancestors of the search target, the type of the search target doesn't narrow down the candidates.
 		for (const auto& WidgetPrinterClass : WidgetPrinterClasses)
 		{
 			if (!IsValid(WidgetPrinterClass))
@@ -82,10 +221,11 @@ namespace GraphPrinter
 				continue;
 			}
 
-			if (auto* WidgetPrinter = NewObject<UWidgetPrinter>(GetTransientPackage(), WidgetPrinterClass))
+			if (auto* WidgetPrinter = GetPrinterInstance(WidgetPrinterClass))
 			{
 				if (WidgetPrinter->CanPrintWidget(Options))
 				{
+					AddCachedResolution(Options->SearchTarget, Options->GetClass(), Options->PrintScope, Options->ExportMethod, WidgetPrinterClass);
 					return WidgetPrinter;
 				}
 			}
@@ -96,6 +236,19 @@ namespace GraphPrinter
 	
 	UWidgetPrinter* FWidgetPrinterRegistryImpl::FindAvailableWidgetPrinter(URestoreWidgetOptions* Options) const
 	{
+		check(IsValid(Options));
+
+		// Since the restoration doesn't have a print scope and an export method, uses fixed values for the key.
+		static constexpr auto PrintScope = UPrintWidgetOptions::EPrintScope::All;
+		static constexpr auto ExportMethod = UPrintWidgetOptions::EExportMethod::ImageFile;
+		
+		TSubclassOf<UWidgetPrinter> CachedPrinterClass;
+		if (FindCachedResolution(Options->SearchTarget, Options->GetClass(), PrintScope, ExportMethod, CachedPrinterClass))
+		{
+			return GetPrinterInstance(CachedPrinterClass);
+		}
+		
+		// Since the printers look for the widget to print among the ancestors of the search target, the type of the search target doesn't narrow down the candidates.
 		for (const auto& WidgetPrinterClass : WidgetPrinterClasses)
 		{
 			if (!IsValid(WidgetPrinterClass))
@@ -103,10 +256,11 @@ namespace GraphPrinter
 				continue;
 			}
 
-			if (auto* WidgetPrinter = NewObject<UWidgetPrinter>(GetTransientPackage(), WidgetPrinterClass))
+			if (auto* WidgetPrinter = GetPrinterInstance(WidgetPrinterClass))
 			{
 				if (WidgetPrinter->CanRestoreWidget(Options))
 				{
+					AddCachedResolution(Options->SearchTarget, Options->GetClass(), PrintScope, ExportMethod, WidgetPrinterClass);
 					return WidgetPrinter;
 				}
 			}
@@ -115,9 +269,27 @@ namespace GraphPrinter
 		return nullptr;
 	}
 
+	void FWidgetPrinterRegistryImpl::PrintWidgets(const TArray<UPrintWidgetOptions*>& OptionsList, const FOnPrintWidgetsFinished& OnFinished)
+	{
+		IPrintJobQueue::Get().SubmitBatch(
+			OptionsList,
+			EPrintJobPriority::Batch,
+			FOnPrintJobProgress::CreateLambda(
+				[OnFinished](const FPrintJobProgress& Progress)
+				{
+					if (Progress.IsCompleted())
+					{
+						OnFinished.ExecuteIfBound(Progress.NumSucceededWidgets);
+					}
+				}
+			)
+		);
+	}
+
 	TOptional<FSupportedWidget> FWidgetPrinterRegistryImpl::CheckIfSupported(const TSharedRef<SWidget>& TestWidget) const
 	{
-		for (const auto& WidgetPrinterClass : WidgetPrinterClasses)
+		// Since this is called for every widget in the window, the printers are narrowed down by the type of the widget.
+		for (const auto& WidgetPrinterClass : GetCandidateWidgetPrinterClasses(TestWidget))
 		{
 			if (!IsValid(WidgetPrinterClass))
 			{
@@ -148,6 +320,13 @@ namespace GraphPrinter
 
 		IMainFrameModule::Get().OnMainFrameCreationFinished().RemoveAll(this);
 	}
+
+	void FWidgetPrinterRegistryImpl::HandleOnPostEngineInit()
+	{
+		FCoreDelegates::OnPostEngineInit.RemoveAll(this);
+		
+		BindInvalidationEvents();
+	}
 	
 #if UE_5_00_OR_LATER
 	void FWidgetPrinterRegistryImpl::HandleOnReloadComplete(EReloadCompleteReason ReloadCompleteReason)
@@ -158,8 +337,29 @@ namespace GraphPrinter
 		CollectWidgetPrinters();
 	}
 
+	void FWidgetPrinterRegistryImpl::HandleOnFocusChanging(
+		const FFocusEvent& FocusEvent,
+		const FWeakWidgetPath& OldFocusedWidgetPath,
+		const TSharedPtr<SWidget>& OldFocusedWidget,
+		const FWidgetPath& NewFocusedWidgetPath,
+		const TSharedPtr<SWidget>& NewFocusedWidget
+	)
+	{
+		InvalidateResolutionCache();
+	}
+
+	void FWidgetPrinterRegistryImpl::HandleOnActiveTabChanged(TSharedPtr<SDockTab> PreviouslyActive, TSharedPtr<SDockTab> NewlyActivated)
+	{
+		InvalidateResolutionCache();
+	}
+
 	void FWidgetPrinterRegistryImpl::CollectWidgetPrinters()
 	{
+		// The classes may have been replaced by the hot reload, so the cached results and instances are discarded.
+		InvalidateResolutionCache();
+		PrinterInstances.Reset();
+		CandidateWidgetPrinterClassesByType.Reset();
+		UntypedWidgetPrinterClasses.Reset();
 		WidgetPrinterClasses.Reset();
 
 		for (auto* Class : TObjectRange<UClass>())
@@ -189,6 +389,8 @@ namespace GraphPrinter
 			}
 		);
 		
+		BuildCandidateWidgetPrinterClassesByType();
+		
 		UE_LOG(LogGraphPrinter, Log, TEXT("---------- Registered Widget Printer Classes ----------"));
 		for (const auto& WidgetPrinterClass : WidgetPrinterClasses)
 		{
@@ -200,6 +402,189 @@ namespace GraphPrinter
 		UE_LOG(LogGraphPrinter, Log, TEXT("-------------------------------------------------------"));
 	}
 
+	const TArray<TSubclassOf<UWidgetPrinter>>& FWidgetPrinterRegistryImpl::GetCandidateWidgetPrinterClasses(const TSharedRef<SWidget>& Widget) const
+	{
+		if (const TArray<TSubclassOf<UWidgetPrinter>>* CandidateWidgetPrinterClasses = CandidateWidgetPrinterClassesByType.Find(Widget->GetType()))
+		{
+			return *CandidateWidgetPrinterClasses;
+		}
+
+		return UntypedWidgetPrinterClasses;
+	}
+
+	void FWidgetPrinterRegistryImpl::BuildCandidateWidgetPrinterClassesByType()
+	{
+		// Finds the position of the printer with the lowest priority among the printers that declare each type.
+		TMap<FName, int32> LastDeclaringIndices;
+		for (int32 Index = 0; Index < WidgetPrinterClasses.Num(); Index++)
+		{
+			const TArray<FName>& TypeNames = UWidgetPrinter::GetSupportedWidgetTypeNames(WidgetPrinterClasses[Index]);
+			if (TypeNames.Num() == 0)
+			{
+				UntypedWidgetPrinterClasses.Add(WidgetPrinterClasses[Index]);
+				continue;
+			}
+			
+			for (const FName& TypeName : TypeNames)
+			{
+				LastDeclaringIndices.Add(TypeName, Index);
+			}
+		}
+
+		// Since the typed printers only return widgets of the types they declare, which are also visited when collecting,
+		// the typed printers with a lower priority than all printers that declare the type can only return an ancestor, which is visited and checked separately.
+		// The typed printers with a higher priority are kept so that a printer that handles an ancestor of the widget wins, as when printing.
+		for (const auto& Pair : LastDeclaringIndices)
+		{
+			TArray<TSubclassOf<UWidgetPrinter>>& CandidateWidgetPrinterClasses = CandidateWidgetPrinterClassesByType.Add(Pair.Key);
+			for (int32 Index = 0; Index < WidgetPrinterClasses.Num(); Index++)
+			{
+				if (Index <= Pair.Value || UntypedWidgetPrinterClasses.Contains(WidgetPrinterClasses[Index]))
+				{
+					CandidateWidgetPrinterClasses.Add(WidgetPrinterClasses[Index]);
+				}
+			}
+		}
+	}
+
+	bool FWidgetPrinterRegistryImpl::FindCachedResolution(
+		const TSharedPtr<SWidget>& SearchTarget,
+		const UClass* OptionsClass,
+		const UPrintWidgetOptions::EPrintScope PrintScope,
+		const UPrintWidgetOptions::EExportMethod ExportMethod,
+		TSubclassOf<UWidgetPrinter>& OutPrinterClass
+	) const
+	{
+		if (!WidgetPrinterRegistryInternal::CanCacheResolution(SearchTarget, PrintScope))
+		{
+			return false;
+		}
+		
+		// The results for the search targets that have been destroyed are never used again.
+		ResolutionCache.RemoveAll(
+			[](const FResolutionCacheEntry& Entry) -> bool
+			{
+				return !Entry.SearchTarget.IsValid();
+			}
+		);
+		
+		for (const auto& Entry : ResolutionCache)
+		{
+			if (!Entry.SearchTarget.HasSameObject(SearchTarget.Get()) || Entry.OptionsClass.Get() != OptionsClass)
+			{
+				continue;
+			}
+			
+			if (Entry.PrintScope != PrintScope || Entry.ExportMethod != ExportMethod)
+			{
+				continue;
+			}
+
+			// The class may have been destroyed by the hot reload.
+			if (!IsValid(Entry.PrinterClass))
+			{
+				return false;
+			}
+
+			OutPrinterClass = Entry.PrinterClass;
+			return true;
+		}
+
+		return false;
+	}
+
+	void FWidgetPrinterRegistryImpl::AddCachedResolution(
+		const TSharedPtr<SWidget>& SearchTarget,
+		const UClass* OptionsClass,
+		const UPrintWidgetOptions::EPrintScope PrintScope,
+		const UPrintWidgetOptions::EExportMethod ExportMethod,
+		const TSubclassOf<UWidgetPrinter>& PrinterClass
+	) const
+	{
+		if (!WidgetPrinterRegistryInternal::CanCacheResolution(SearchTarget, PrintScope))
+		{
+			return;
+		}
+		
+		RemoveCachedResolution(SearchTarget, OptionsClass, PrintScope, ExportMethod);
+		
+		FResolutionCacheEntry& Entry = ResolutionCache.AddDefaulted_GetRef();
+		Entry.SearchTarget = SearchTarget;
+		Entry.OptionsClass = OptionsClass;
+		Entry.PrintScope = PrintScope;
+		Entry.ExportMethod = ExportMethod;
+		Entry.PrinterClass = PrinterClass;
+	}
+
+	void FWidgetPrinterRegistryImpl::RemoveCachedResolution(
+		const TSharedPtr<SWidget>& SearchTarget,
+		const UClass* OptionsClass,
+		const UPrintWidgetOptions::EPrintScope PrintScope,
+		const UPrintWidgetOptions::EExportMethod ExportMethod
+	) const
+	{
+		ResolutionCache.RemoveAll(
+			[&](const FResolutionCacheEntry& Entry) -> bool
+			{
+				return (
+					Entry.SearchTarget.HasSameObject(SearchTarget.Get()) &&
+					Entry.OptionsClass.Get() == OptionsClass &&
+					Entry.PrintScope == PrintScope &&
+					Entry.ExportMethod == ExportMethod
+				);
+			}
+		);
+	}
+
+	UWidgetPrinter* FWidgetPrinterRegistryImpl::GetPrinterInstance(const TSubclassOf<UWidgetPrinter>& PrinterClass) const
+	{
+		if (!IsValid(PrinterClass))
+		{
+			return nullptr;
+		}
+
+		TArray<TStrongObjectPtr<UWidgetPrinter>>& Instances = PrinterInstances.FindOrAdd(PrinterClass.Get());
+		for (const TStrongObjectPtr<UWidgetPrinter>& Instance : Instances)
+		{
+			if (Instance.IsValid() && !Instance->IsBusy())
+			{
+				return Instance.Get();
+			}
+		}
+
+		// If all instances are in the middle of printing, for example in batch printing, creates a new instance.
+		// The new instance is also kept here so that it is not garbage collected while printing.
+		auto* NewInstance = NewObject<UWidgetPrinter>(GetTransientPackage(), PrinterClass);
+		if (!IsValid(NewInstance))
+		{
+			return nullptr;
+		}
+		
+		Instances.Emplace(NewInstance);
+		return NewInstance;
+	}
+
+	void FWidgetPrinterRegistryImpl::BindInvalidationEvents()
+	{
+		if (!OnActiveTabChangedHandle.IsValid())
+		{
+			OnActiveTabChangedHandle = FGlobalTabmanager::Get()->OnActiveTabChanged_Subscribe(
+				FGlobalTabmanager::FOnActiveTabChanged::FDelegate::CreateRaw(this, &FWidgetPrinterRegistryImpl::HandleOnActiveTabChanged)
+			);
+		}
+		
+		if (!bIsFocusChangingBound && FSlateApplication::IsInitialized())
+		{
+			FSlateApplication::Get().OnFocusChanging().AddRaw(this, &FWidgetPrinterRegistryImpl::HandleOnFocusChanging);
+			bIsFocusChangingBound = true;
+		}
+	}
+
+	void FWidgetPrinterRegistryImpl::InvalidateResolutionCache()
+	{
+		ResolutionCache.Reset();
+	}
+
 	namespace WidgetPrinterRegistry
 	{
 		static TUniquePtr<FWidgetPrinterRegistryImpl> Instance;
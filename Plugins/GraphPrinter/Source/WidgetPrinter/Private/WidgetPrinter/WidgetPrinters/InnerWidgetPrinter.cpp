@@ -1,52 +1,184 @@
 // Copyright 2020-2026 Naotsun. All Rights Reserved.
 
 #include "WidgetPrinter/WidgetPrinters/InnerWidgetPrinter.h"
+#include "WidgetPrinter/Rendering/WidgetRenderTargetPool.h"
+#include "WidgetPrinter/Rendering/AsyncRenderTargetReadback.h"
+#include "WidgetPrinter/ImageWriters/ParallelPngEncoder.h"
 #include "Slate/WidgetRenderer.h"
+#include "ImageWriteQueue.h"
+#include "ImageWriteTask.h"
+#include "ImagePixelData.h"
+#include "HAL/FileManager.h"
+#include "Serialization/Archive.h"
+#include "TextureResource.h"
 #include "RenderingThread.h"
+#include "Modules/ModuleManager.h"
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#ifdef WITH_TEXT_CHUNK_HELPER
+#include "TextChunkHelper/ITextChunkHelper.h"
+#endif
 
 namespace GraphPrinter
 {
+	namespace InnerWidgetPrinterInternal
+	{
+		// Notifies the result of the task running on a worker thread on the game thread when it is finished.
+		void NotifyResultOnGameThread(const TSharedRef<TFuture<bool>>& Result, const TFunction<void(const bool bIsSucceeded)>& OnFinished)
+		{
+#if UE_5_00_OR_LATER
+			FTSTicker::GetCoreTicker().AddTicker(
+#else
+			FTicker::GetCoreTicker().AddTicker(
+#endif
+				FTickerDelegate::CreateLambda(
+					[Result, OnFinished](float DeltaTime) -> bool
+					{
+						if (!Result->IsReady())
+						{
+							return true;
+						}
+
+						if (OnFinished)
+						{
+							OnFinished(Result->Get());
+						}
+						return false;
+					}
+				)
+			);
+		}
+		
+#ifdef WITH_TEXT_CHUNK_HELPER
+		// Converts the format selected in the settings to the format of the text chunk helper.
+		TextChunkHelper::ETextChunkFormat ToTextChunkFormat(const EWidgetInfoFormat Format)
+		{
+			switch (Format)
+			{
+			case EWidgetInfoFormat::Compressed:
+				return TextChunkHelper::ETextChunkFormat::Compressed;
+			case EWidgetInfoFormat::CompressedUnicode:
+				return TextChunkHelper::ETextChunkFormat::CompressedUnicode;
+			default:
+				break;
+			}
+
+			return TextChunkHelper::ETextChunkFormat::Uncompressed;
+		}
+#endif
+	}
+	
 	void IInnerWidgetPrinter::SetOnRendered(const FOnRendered& InOnRendered)
 	{
 		OnRendered = InOnRendered;
 	}
 
+	bool IInnerWidgetPrinter::IsPrintSucceeded() const
+	{
+		return bIsPrintSucceeded;
+	}
+
 	UTextureRenderTarget2D* IInnerWidgetPrinter::DrawWidgetToRenderTargetInternal(
 		const TSharedRef<SWidget>& Widget,
 		const FVector2D& DrawSize,
 		const TextureFilter FilteringMode,
 		const bool bUseGamma,
-		const float RenderingScale
+		const float RenderingScale,
+		const bool bUsePooledRenderTarget,
+		const bool bWaitForDrawing
 	)
 	{
-		FWidgetRenderer* WidgetRenderer = new FWidgetRenderer(bUseGamma, false);
-		if (WidgetRenderer == nullptr)
+		const FIntPoint Size(DrawSize.X, DrawSize.Y);
+		UTextureRenderTarget2D* RenderTarget = (
+			bUsePooledRenderTarget ?
+			AcquireRenderTargetInternal(Size, FilteringMode, bUseGamma) :
+			CreateRenderTargetInternal(Size, FilteringMode, bUseGamma)
+		);
+		if (!IsValid(RenderTarget))
 		{
-			UE_LOG(LogGraphPrinter, Error, TEXT("Widget Renderer could not be generated."));
 			return nullptr;
 		}
 
-		// Creates the render target manually instead of using FWidgetRenderer::CreateTargetFor
-		// to ensure bForceLinearGamma is set BEFORE InitCustomFormat creates the GPU resource.
-		// CreateTargetFor creates the resource with bForceLinearGamma=false (via InitCustomFormat)
-		// and then the code changes it to true afterwards, but UpdateResourceImmediate only clears
-		// the existing resource without recreating it with the new format.
-		// This causes the GPU resource to remain in sRGB format while the shader outputs
-		// gamma-corrected values, resulting in double gamma correction (whitish appearance).
-		UTextureRenderTarget2D* RenderTarget = NewObject<UTextureRenderTarget2D>();
-		if (!IsValid(RenderTarget))
+		if (!DrawWidgetToExistingRenderTargetInternal(RenderTarget, Widget, DrawSize, bUseGamma, RenderingScale, bWaitForDrawing))
 		{
-			UE_LOG(LogGraphPrinter, Error, TEXT("Failed to generate RenderTarget."));
+			ReleaseRenderTargetInternal(RenderTarget);
 			return nullptr;
 		}
-		RenderTarget->Filter = FilteringMode;
-		RenderTarget->ClearColor = FLinearColor::Transparent;
-		RenderTarget->SRGB = bUseGamma;
-		RenderTarget->bForceLinearGamma = bUseGamma;
-		RenderTarget->TargetGamma = 1.f;
-		RenderTarget->InitCustomFormat(DrawSize.X, DrawSize.Y, PF_B8G8R8A8, bUseGamma);
-		RenderTarget->UpdateResourceImmediate(true);
-		FlushRenderingCommands();
+
+		return RenderTarget;
+	}
+
+	UTextureRenderTarget2D* IInnerWidgetPrinter::CreateRenderTargetInternal(
+		const FIntPoint& Size,
+		const TextureFilter FilteringMode,
+		const bool bUseGamma
+	)
+	{
+		return FWidgetRenderTargetPool::CreateRenderTarget(Size, PF_B8G8R8A8, FilteringMode, bUseGamma);
+	}
+
+	UTextureRenderTarget2D* IInnerWidgetPrinter::AcquireRenderTargetInternal(
+		const FIntPoint& Size,
+		const TextureFilter FilteringMode,
+		const bool bUseGamma
+	)
+	{
+		if (!FWidgetRenderTargetPool::IsAvailable())
+		{
+			return CreateRenderTargetInternal(Size, FilteringMode, bUseGamma);
+		}
+		
+		return FWidgetRenderTargetPool::Get().AcquireRenderTarget(Size, PF_B8G8R8A8, FilteringMode, bUseGamma);
+	}
+
+	void IInnerWidgetPrinter::ReleaseRenderTargetInternal(UTextureRenderTarget2D* RenderTarget)
+	{
+		if (!FWidgetRenderTargetPool::IsAvailable())
+		{
+			return;
+		}
+
+		FWidgetRenderTargetPool::Get().ReleaseRenderTarget(RenderTarget);
+	}
+
+	bool IInnerWidgetPrinter::DrawWidgetToExistingRenderTargetInternal(
+		UTextureRenderTarget2D* RenderTarget,
+		const TSharedRef<SWidget>& Widget,
+		const FVector2D& DrawSize,
+		const bool bUseGamma,
+		const float RenderingScale,
+		const bool bWaitForDrawing
+	)
+	{
+		if (!IsValid(RenderTarget))
+		{
+			return false;
+		}
+		
+		// Uses the widget renderers of the pool so that they are not created and released for each drawing.
+		if (FWidgetRenderTargetPool::IsAvailable())
+		{
+			FWidgetRenderTargetPool::Get().DrawWidget(
+				RenderTarget,
+				Widget,
+				DrawSize,
+				bUseGamma,
+				RenderingScale
+			);
+			if (bWaitForDrawing)
+			{
+				FlushRenderingCommands();
+			}
+
+			return true;
+		}
+		
+		FWidgetRenderer* WidgetRenderer = new FWidgetRenderer(bUseGamma, false);
+		if (WidgetRenderer == nullptr)
+		{
+			UE_LOG(LogGraphPrinter, Error, TEXT("Widget Renderer could not be generated."));
+			return false;
+		}
 
 		WidgetRenderer->DrawWidget(
 			RenderTarget,
@@ -59,13 +191,35 @@ namespace GraphPrinter
 
 		BeginCleanup(WidgetRenderer);
 
-		return RenderTarget;
+		return true;
+	}
+
+	bool IInnerWidgetPrinter::ReadRenderTargetPixelsInternal(
+		UTextureRenderTarget2D* RenderTarget,
+		const FIntRect& Rect,
+		TArray<FColor>& OutPixels
+	)
+	{
+		if (!IsValid(RenderTarget))
+		{
+			return false;
+		}
+
+		FTextureRenderTargetResource* RenderTargetResource = RenderTarget->GameThread_GetRenderTargetResource();
+		if (RenderTargetResource == nullptr)
+		{
+			return false;
+		}
+
+		// Uses the same flags as UImageWriteBlueprintLibrary::ExportToDisk so that the output matches the untiled drawing.
+		return RenderTargetResource->ReadPixels(OutPixels, FReadSurfaceDataFlags(), Rect);
 	}
 
 	void IInnerWidgetPrinter::ExportRenderTargetToImageFileInternal(
 		UTextureRenderTarget2D* RenderTarget,
 		const FString& Filename,
-		const FImageWriteOptions& ImageWriteOptions
+		const FImageWriteOptions& ImageWriteOptions,
+		const EPngColorReduction PngColorReduction
 	)
 	{
 		if (!IsValid(RenderTarget))
@@ -73,10 +227,242 @@ namespace GraphPrinter
 			return;
 		}
 
+		// Since png encoding takes most of the time for large images, reads the pixels here and encodes them on multiple threads.
+		if (ImageWriteOptions.Format == EDesiredImageFormat::PNG)
+		{
+			TArray<FColor> Pixels;
+			const bool bIsRead = ReadRenderTargetPixelsInternal(RenderTarget, FIntRect(0, 0, RenderTarget->SizeX, RenderTarget->SizeY), Pixels);
+			const FIntPoint ImageSize = bIsRead ? FIntPoint(RenderTarget->SizeX, RenderTarget->SizeY) : FIntPoint::ZeroValue;
+			ExportPixelsToImageFileInternal(ImageSize, TArray64<FColor>(MoveTemp(Pixels)), Filename, ImageWriteOptions, nullptr, PngColorReduction);
+			return;
+		}
+
 		UImageWriteBlueprintLibrary::ExportToDisk(
 			RenderTarget,
 			Filename,
 			ImageWriteOptions
 		);
 	}
+
+	bool IInnerWidgetPrinter::IsAsyncReadbackSupported()
+	{
+		return FAsyncRenderTargetReadback::IsSupported();
+	}
+
+	bool IInnerWidgetPrinter::ExportRenderTargetToImageFileAsyncInternal(
+		UTextureRenderTarget2D* RenderTarget,
+		const FString& Filename,
+		const FImageWriteOptions& ImageWriteOptions,
+		const TSharedPtr<const FWidgetInfoToEmbed>& WidgetInfoToEmbed,
+		const EPngColorReduction PngColorReduction
+	)
+	{
+		return FAsyncRenderTargetReadback::Start(
+			RenderTarget,
+			FAsyncRenderTargetReadback::FOnReadbackFinished::CreateLambda(
+				[RenderTarget, Filename, ImageWriteOptions, WidgetInfoToEmbed, PngColorReduction](const bool bIsSucceeded, const FIntPoint& ImageSize, TArray64<FColor>& Pixels)
+				{
+					// The readback holds the render target until this event is finished.
+					ReleaseRenderTargetInternal(RenderTarget);
+					
+					if (!bIsSucceeded)
+					{
+						if (ImageWriteOptions.NativeOnComplete)
+						{
+							ImageWriteOptions.NativeOnComplete(false);
+						}
+						return;
+					}
+
+					ExportPixelsToImageFileInternal(ImageSize, MoveTemp(Pixels), Filename, ImageWriteOptions, WidgetInfoToEmbed, PngColorReduction);
+				}
+			)
+		);
+	}
+
+	void IInnerWidgetPrinter::ExportPixelsToImageFileInternal(
+		const FIntPoint& ImageSize,
+		TArray64<FColor>&& Pixels,
+		const FString& Filename,
+		const FImageWriteOptions& ImageWriteOptions,
+		const TSharedPtr<const FWidgetInfoToEmbed>& WidgetInfoToEmbed,
+		const EPngColorReduction PngColorReduction
+	)
+	{
+		if (Pixels.Num() == 0 || Pixels.Num() != static_cast<int64>(ImageSize.X) * ImageSize.Y)
+		{
+			if (ImageWriteOptions.NativeOnComplete)
+			{
+				ImageWriteOptions.NativeOnComplete(false);
+			}
+			return;
+		}
+
+		if (ImageWriteOptions.Format == EDesiredImageFormat::PNG)
+		{
+			ExportPixelsToPngFileInternal(ImageSize, MoveTemp(Pixels), Filename, ImageWriteOptions, WidgetInfoToEmbed, PngColorReduction);
+			return;
+		}
+		
+		// Writes the pixels in the same way as UImageWriteBlueprintLibrary::ExportToDisk.
+		TUniquePtr<FImageWriteTask> ImageWriteTask = MakeUnique<FImageWriteTask>();
+		ImageWriteTask->PixelData = MakeUnique<TImagePixelData<FColor>>(ImageSize, MoveTemp(Pixels));
+		ImageWriteTask->Filename = Filename;
+		ImageWriteTask->Format = ImageWriteOptions.Format;
+		ImageWriteTask->CompressionQuality = ImageWriteOptions.CompressionQuality;
+		ImageWriteTask->bOverwriteFile = ImageWriteOptions.bOverwriteFile;
+		ImageWriteTask->OnCompleted = ImageWriteOptions.NativeOnComplete;
+
+		IImageWriteQueueModule& ImageWriteQueueModule = FModuleManager::LoadModuleChecked<IImageWriteQueueModule>(TEXT("ImageWriteQueue"));
+		TFuture<bool> DispatchedTask = ImageWriteQueueModule.GetWriteQueue().Enqueue(MoveTemp(ImageWriteTask));
+		if (!ImageWriteOptions.bAsync)
+		{
+			DispatchedTask.Wait();
+		}
+	}
+
+	void IInnerWidgetPrinter::ExportPixelsToPngFileInternal(
+		const FIntPoint& ImageSize,
+		TArray64<FColor>&& Pixels,
+		const FString& Filename,
+		const FImageWriteOptions& ImageWriteOptions,
+		const TSharedPtr<const FWidgetInfoToEmbed>& WidgetInfoToEmbed,
+		const EPngColorReduction PngColorReduction
+	)
+	{
+#ifdef WITH_TEXT_CHUNK_HELPER
+		// Loads the module on the game thread in advance as it cannot be loaded on a worker thread.
+		TextChunkHelper::ITextChunkHelper& TextChunkHelper = TextChunkHelper::ITextChunkHelper::Get();
+
+		const TextChunkHelper::ETextChunkFormat TextChunkFormat = (
+			WidgetInfoToEmbed.IsValid() ?
+			InnerWidgetPrinterInternal::ToTextChunkFormat(WidgetInfoToEmbed->Format) :
+			TextChunkHelper::ETextChunkFormat::Uncompressed
+		);
+#endif
+
+		const int32 CompressionQuality = ImageWriteOptions.CompressionQuality;
+		const bool bOverwriteFile = ImageWriteOptions.bOverwriteFile;
+		const TSharedRef<TFuture<bool>> Result = MakeShared<TFuture<bool>>(
+			Async(
+				EAsyncExecution::ThreadPool,
+#ifdef WITH_TEXT_CHUNK_HELPER
+				[&TextChunkHelper, ImageSize, Pixels = MoveTemp(Pixels), Filename, CompressionQuality, bOverwriteFile, PngColorReduction, WidgetInfoToEmbed, TextChunkFormat]() -> bool
+#else
+				[ImageSize, Pixels = MoveTemp(Pixels), Filename, CompressionQuality, bOverwriteFile, PngColorReduction]() -> bool
+#endif
+				{
+					if (!bOverwriteFile && IFileManager::Get().FileExists(*Filename))
+					{
+						return false;
+					}
+
+					// Filters and compresses the bands of rows on multiple threads instead of the single-threaded encoder of the image wrapper.
+					// The pixels are analyzed before encoding to drop the alpha channel or use a palette if no color changes.
+					TArray64<uint8> CompressedData;
+					if (!FParallelPngEncoder::Encode(ImageSize, Pixels.GetData(), CompressionQuality, CompressedData, PngColorReduction))
+					{
+						return false;
+					}
+
+#ifdef WITH_TEXT_CHUNK_HELPER
+					// Splices the text chunks into the encoded image in memory and writes the result to the file once.
+					if (WidgetInfoToEmbed.IsValid())
+					{
+						const TSharedPtr<TextChunkHelper::ITextChunk> TextChunk = TextChunkHelper.CreateTextChunkFromMemory(
+							Filename,
+							CompressedData.GetData(),
+							CompressedData.Num()
+						);
+						if (!TextChunk.IsValid())
+						{
+							return false;
+						}
+
+						return TextChunk->Write(WidgetInfoToEmbed->MapToWrite, TextChunkFormat);
+					}
+#endif
+
+					const TUniquePtr<FArchive> FileWriter = TUniquePtr<FArchive>(IFileManager::Get().CreateFileWriter(*Filename));
+					if (!FileWriter.IsValid())
+					{
+						return false;
+					}
+
+					FileWriter->Serialize(CompressedData.GetData(), CompressedData.Num());
+					return FileWriter->Close();
+				}
+			)
+		);
+
+		if (!ImageWriteOptions.bAsync)
+		{
+			Result->Wait();
+		}
+
+		InnerWidgetPrinterInternal::NotifyResultOnGameThread(Result, ImageWriteOptions.NativeOnComplete);
+	}
+
+	bool IInnerWidgetPrinter::EncodeWidgetInfoToEmbedInternal(
+		const EDesiredImageFormat ImageFormat,
+		const TSharedPtr<const FWidgetInfoToEmbed>& WidgetInfoToEmbed,
+		TArray<uint8>& OutEncodedData
+	)
+	{
+		OutEncodedData.Reset();
+		if (!WidgetInfoToEmbed.IsValid())
+		{
+			return true;
+		}
+		
+#ifdef WITH_TEXT_CHUNK_HELPER
+		return TextChunkHelper::ITextChunkHelper::Get().EncodeTextChunks(
+			ImageFormat,
+			WidgetInfoToEmbed->MapToWrite,
+			InnerWidgetPrinterInternal::ToTextChunkFormat(WidgetInfoToEmbed->Format),
+			OutEncodedData
+		);
+#else
+		return false;
+#endif
+	}
+
+	void IInnerWidgetPrinter::WriteTextChunkAsyncInternal(
+		const FString& Filename,
+		const TMap<FString, FString>& MapToWrite,
+		const EWidgetInfoFormat Format,
+		const TFunction<void(const bool bIsSucceeded)>& OnFinished
+	)
+	{
+#ifdef WITH_TEXT_CHUNK_HELPER
+		// Loads the module on the game thread in advance as it cannot be loaded on a worker thread.
+		TextChunkHelper::ITextChunkHelper& TextChunkHelper = TextChunkHelper::ITextChunkHelper::Get();
+
+		const TextChunkHelper::ETextChunkFormat TextChunkFormat = InnerWidgetPrinterInternal::ToTextChunkFormat(Format);
+		
+		const TSharedRef<TFuture<bool>> Result = MakeShared<TFuture<bool>>(
+			Async(
+				EAsyncExecution::ThreadPool,
+				[&TextChunkHelper, Filename, MapToWrite, TextChunkFormat]() -> bool
+				{
+					const TSharedPtr<TextChunkHelper::ITextChunk> TextChunk = TextChunkHelper.CreateTextChunk(Filename);
+					if (!TextChunk.IsValid())
+					{
+						return false;
+					}
+					
+					return TextChunk->Write(MapToWrite, TextChunkFormat);
+				}
+			)
+		);
+
+		// Waits for the result on the game thread so that the printer is not accessed from the worker thread.
+		InnerWidgetPrinterInternal::NotifyResultOnGameThread(Result, OnFinished);
+#else
+		if (OnFinished)
+		{
+			OnFinished(false);
+		}
+#endif
+	}
 }
@@ -2,6 +2,7 @@
 
 #include "WidgetPrinter/WidgetPrinters/WidgetPrinter.h"
 #include "WidgetPrinter/WidgetPrinters/InnerWidgetPrinter.h"
+#include "WidgetPrinter/IPrintJobQueue.h"
 #include "WidgetPrinter/Utilities/WidgetPrinterSettings.h"
 #include "WidgetPrinter/Utilities/WidgetPrinterUtils.h"
 #include "GraphPrinterGlobals/GraphPrinterGlobals.h"
@@ -20,18 +21,21 @@ UWidgetPrinter::UWidgetPrinter()
 {
 }
 
-void UWidgetPrinter::PrintWidget(UPrintWidgetOptions* Options)
+void UWidgetPrinter::PrintWidget(UPrintWidgetOptions* Options, const FOnPrintFinished& InOnPrintFinished)
 {
 	check(IsValid(Options));
 	CachedPrintOptions = Options;
+	OnPrintFinished = InOnPrintFinished;
 
 	// Temporarily excludes the instance from garbage collection to prevent the instance from being destroyed during printer processing.
 	AddToRoot();
 
-	InnerPrinter = CreatePrintModeInnerPrinter(
+	// Holds the reference locally as the inner printer may be discarded while printing if the processing is finished synchronously.
+	const TSharedRef<GraphPrinter::IInnerWidgetPrinter> PrintModeInnerPrinter = CreatePrintModeInnerPrinter(
 		FSimpleDelegate::CreateUObject(this, &UWidgetPrinter::CleanupPrinter)
 	);
-	InnerPrinter->PrintWidget();
+	InnerPrinter = PrintModeInnerPrinter;
+	PrintModeInnerPrinter->PrintWidget();
 }
 
 bool UWidgetPrinter::CanPrintWidget(UPrintWidgetOptions* Options)
@@ -39,10 +43,29 @@ bool UWidgetPrinter::CanPrintWidget(UPrintWidgetOptions* Options)
 	check(IsValid(Options));
 	CachedPrintOptions = Options;
 
-	InnerPrinter = CreatePrintModeInnerPrinter(
+	// Since the inner printer is only used for the check, doesn't keep it so that this instance can be reused.
+	const TSharedRef<GraphPrinter::IInnerWidgetPrinter> PrintModeInnerPrinter = CreatePrintModeInnerPrinter(
 		FSimpleDelegate::CreateUObject(this, &UWidgetPrinter::CleanupPrinter)
 	);
-	return InnerPrinter->CanPrintWidget();
+	const bool bCanPrintWidget = PrintModeInnerPrinter->CanPrintWidget();
+	CachedPrintOptions = nullptr;
+	
+	return bCanPrintWidget;
+}
+
+TSharedPtr<SWidget> UWidgetPrinter::FindWidgetToPrint(UPrintWidgetOptions* Options)
+{
+	check(IsValid(Options));
+	CachedPrintOptions = Options;
+
+	// Since the inner printer is only used for the search, doesn't keep it so that this instance can be reused.
+	const TSharedRef<GraphPrinter::IInnerWidgetPrinter> PrintModeInnerPrinter = CreatePrintModeInnerPrinter(
+		FSimpleDelegate::CreateUObject(this, &UWidgetPrinter::CleanupPrinter)
+	);
+	const TSharedPtr<SWidget> WidgetToPrint = PrintModeInnerPrinter->FindWidgetToPrint();
+	CachedPrintOptions = nullptr;
+	
+	return WidgetToPrint;
 }
 
 void UWidgetPrinter::RestoreWidget(URestoreWidgetOptions* Options)
@@ -50,10 +73,14 @@ void UWidgetPrinter::RestoreWidget(URestoreWidgetOptions* Options)
 	check(IsValid(Options));
 	CachedRestoreOptions = Options;
 
-	InnerPrinter = CreateRestoreModeInnerPrinter(
+	// Since the restoration is finished synchronously, discards the inner printer so that this instance can be reused.
+	const TSharedRef<GraphPrinter::IInnerWidgetPrinter> RestoreModeInnerPrinter = CreateRestoreModeInnerPrinter(
 		FSimpleDelegate::CreateUObject(this, &UWidgetPrinter::CleanupPrinter)
 	);
-	InnerPrinter->RestoreWidget();
+	InnerPrinter = RestoreModeInnerPrinter;
+	RestoreModeInnerPrinter->RestoreWidget();
+	InnerPrinter.Reset();
+	CachedRestoreOptions = nullptr;
 }
 
 bool UWidgetPrinter::CanRestoreWidget(URestoreWidgetOptions* Options)
@@ -61,10 +88,18 @@ bool UWidgetPrinter::CanRestoreWidget(URestoreWidgetOptions* Options)
 	check(IsValid(Options));
 	CachedRestoreOptions = Options;
 
-	InnerPrinter = CreateRestoreModeInnerPrinter(
+	const TSharedRef<GraphPrinter::IInnerWidgetPrinter> RestoreModeInnerPrinter = CreateRestoreModeInnerPrinter(
 		FSimpleDelegate::CreateUObject(this, &UWidgetPrinter::CleanupPrinter)
 	);
-	return InnerPrinter->CanRestoreWidget();
+	const bool bCanRestoreWidget = RestoreModeInnerPrinter->CanRestoreWidget();
+	CachedRestoreOptions = nullptr;
+	
+	return bCanRestoreWidget;
+}
+
+bool UWidgetPrinter::IsBusy() const
+{
+	return InnerPrinter.IsValid();
 }
 
 int32 UWidgetPrinter::GetPriority() const
@@ -85,6 +120,24 @@ int32 UWidgetPrinter::GetPriority(const TSubclassOf<UWidgetPrinter>& Class)
 	return TNumericLimits<int32>::Min();
 }
 
+TArray<FName> UWidgetPrinter::GetSupportedWidgetTypeNames() const
+{
+	return {};
+}
+
+TArray<FName> UWidgetPrinter::GetSupportedWidgetTypeNames(const TSubclassOf<UWidgetPrinter>& Class)
+{
+	if (IsValid(Class))
+	{
+		if (const auto* WidgetPrinter = Class->GetDefaultObject<UWidgetPrinter>())
+		{
+			return WidgetPrinter->GetSupportedWidgetTypeNames();
+		}
+	}
+
+	return {};
+}
+
 UPrintWidgetOptions* UWidgetPrinter::CreateDefaultPrintOptions(
 	const UPrintWidgetOptions::EPrintScope PrintScope,
 	const UPrintWidgetOptions::EExportMethod ExportMethod
@@ -99,14 +152,20 @@ UPrintWidgetOptions* UWidgetPrinter::CreateDefaultPrintOptions(
 		PrintOptions->ExportMethod = ExportMethod;
 #ifdef WITH_TEXT_CHUNK_HELPER
 		PrintOptions->bIsIncludeWidgetInfoInImageFile = Settings.bIsIncludeWidgetInfoInImageFile;
+		PrintOptions->WidgetInfoFormat = Settings.WidgetInfoFormat;
 #endif
 		PrintOptions->ImageWriteOptions.Format = Settings.Format;
 		PrintOptions->ImageWriteOptions.CompressionQuality = Settings.CompressionQuality;
+		PrintOptions->PngColorReduction = Settings.PngColorReduction;
 		PrintOptions->FilteringMode = Settings.FilteringMode;
 		PrintOptions->bUseGamma = Settings.bUseGamma;
 		PrintOptions->MaxImageSize = Settings.MaxImageSize;
 		PrintOptions->RenderingScale = Settings.RenderingScale;
+		PrintOptions->bEnableTiledRendering = Settings.bEnableTiledRendering;
+		PrintOptions->TileSize = Settings.TileSize;
+		PrintOptions->bUseAsyncReadback = Settings.bUseAsyncReadback;
 		PrintOptions->ImageWriteOptions.bOverwriteFile = Settings.bCanOverwriteFileWhenExport;
+		PrintOptions->bSkipUnchangedExport = Settings.bSkipUnchangedExport;
 		PrintOptions->OutputDirectoryPath = Settings.OutputDirectory.Path;
 		PrintOptions->SearchTarget = GraphPrinter::FWidgetPrinterUtils::GetMostSuitableSearchTarget();
 	}
@@ -135,24 +194,36 @@ UWidgetPrinter::FRenderingResult UWidgetPrinter::GetRenderingResult(
 		return {};
 	}
 	
+	// Since the result is usually used by another printer that is running, it is drawn immediately without waiting in the queue.
 	FRenderingResult ReturnValue;
-	if (auto* WidgetPrinter = NewObject<UWidgetPrinter>(GetTransientPackage(), PrinterClass))
-	{
-		WidgetPrinter->CachedPrintOptions = Options;
-		
-		const TSharedRef<GraphPrinter::IInnerWidgetPrinter> InnerPrinter = WidgetPrinter->CreatePrintModeInnerPrinter(
-			FSimpleDelegate::CreateUObject(WidgetPrinter, &UWidgetPrinter::CleanupPrinter)
-		);
-		InnerPrinter->SetOnRendered(
-			GraphPrinter::IInnerWidgetPrinter::FOnRendered::CreateLambda(
-				[&](FRenderingResult RenderingResult)
-				{
-					ReturnValue = RenderingResult;
-				}
-			)
-		);
-		InnerPrinter->PrintWidget();
-	}
+	GraphPrinter::IPrintJobQueue::Get().ExecuteImmediately(
+		Options,
+		[&]() -> bool
+		{
+			auto* WidgetPrinter = NewObject<UWidgetPrinter>(GetTransientPackage(), PrinterClass);
+			if (!IsValid(WidgetPrinter))
+			{
+				return false;
+			}
+			
+			WidgetPrinter->CachedPrintOptions = Options;
+			
+			const TSharedRef<GraphPrinter::IInnerWidgetPrinter> InnerPrinter = WidgetPrinter->CreatePrintModeInnerPrinter(
+				FSimpleDelegate::CreateUObject(WidgetPrinter, &UWidgetPrinter::CleanupPrinter)
+			);
+			InnerPrinter->SetOnRendered(
+				GraphPrinter::IInnerWidgetPrinter::FOnRendered::CreateLambda(
+					[&](FRenderingResult RenderingResult)
+					{
+						ReturnValue = RenderingResult;
+					}
+				)
+			);
+			InnerPrinter->PrintWidget();
+
+			return ReturnValue.IsValid();
+		}
+	);
 
 	return ReturnValue;
 }
@@ -185,10 +256,17 @@ URestoreWidgetOptions* UWidgetPrinter::GetRestoreOptions() const
 
 void UWidgetPrinter::CleanupPrinter()
 {
+	// The result is taken before the inner printer is discarded.
+	const bool bIsSucceeded = (InnerPrinter.IsValid() && InnerPrinter->IsPrintSucceeded());
+	
 	CachedPrintOptions = nullptr;
 	CachedRestoreOptions = nullptr;
 	InnerPrinter.Reset();
 
 	// Since it is no longer necessary to keep an instance of the printer, it is subjects to garbage collection.
 	RemoveFromRoot();
+
+	const FOnPrintFinished PrintFinished = OnPrintFinished;
+	OnPrintFinished.Unbind();
+	PrintFinished.ExecuteIfBound(bIsSucceeded);
 }
@@ -0,0 +1,58 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WidgetPrinter/Types/PrintJobProgress.h"
+
+class UPrintWidgetOptions;
+
+namespace GraphPrinter
+{
+	/**
+	 * A class that starts all prints in order of priority so that they do not compete with each other.
+	 * Each request is given a job id that can be used to cancel it and to identify it in the progress callbacks.
+	 */
+	class WIDGETPRINTER_API IPrintJobQueue
+	{
+	public:
+		// Registers-Unregisters and instance getter this class.
+		static void Register();
+		static void Unregister();
+		static IPrintJobQueue& Get();
+
+		// Destructor.
+		virtual ~IPrintJobQueue() = default;
+
+		// Adds a job that prints the widget specified by the options and returns its id.
+		// If a job that prints the same widget found from the search target with the same scope and export method is waiting or running, the request is merged into it and its id is returned.
+		virtual int32 Submit(
+			UPrintWidgetOptions* Options,
+			const EPrintJobPriority Priority,
+			const FOnPrintJobProgress& OnProgress = FOnPrintJobProgress()
+		) = 0;
+
+		// Adds a job that prints multiple widgets while overlapping the drawing of one widget with the readback and file writing of the others.
+		// If there is no widget to print, the job is completed before this returns.
+		virtual int32 SubmitBatch(
+			const TArray<UPrintWidgetOptions*>& OptionsList,
+			const EPrintJobPriority Priority,
+			const FOnPrintJobProgress& OnProgress = FOnPrintJobProgress()
+		) = 0;
+
+		// Runs a job that is completed synchronously, such as drawing a widget to the render target used by another printer.
+		// It is not queued since the caller is waiting for the result, but it is given an id and notified like the other jobs.
+		// Execute returns whether the widget was printed successfully.
+		virtual int32 ExecuteImmediately(UPrintWidgetOptions* Options, const TFunctionRef<bool()>& Execute) = 0;
+
+		// Cancels the job. The widgets that have already been started are finished, and the rest are discarded.
+		// Returns false if the job is not found or has already been completed.
+		virtual bool Cancel(const int32 JobId) = 0;
+
+		// Returns the progress of the job, or an unset value if the job is not found or has already been completed.
+		virtual TOptional<FPrintJobProgress> GetProgress(const int32 JobId) const = 0;
+
+		// Returns the event called when the progress of any job changes.
+		virtual FOnAnyPrintJobProgress& OnAnyJobProgress() = 0;
+	};
+}
@@ -22,6 +22,7 @@ namespace GraphPrinter
 		virtual ~ISupportedWidgetRegistry() = default;
 
 		// Collects supported widgets from the currently displayed screen.
+		// The collection is spread over several frames, and only the contents of tabs opened since the last collection are checked.
 		virtual void CollectSupportedWidget() = 0;
 
 		// Returns a list of widgets currently available and supported by any printer.
@@ -16,6 +16,10 @@ namespace GraphPrinter
 	 */
 	class WIDGETPRINTER_API IWidgetPrinterRegistry
 	{
+	public:
+		// Defines the event when all widgets printed by PrintWidgets have been processed.
+		DECLARE_DELEGATE_OneParam(FOnPrintWidgetsFinished, const int32 /* NumSucceededWidgets */);
+		
 	public:
 		// Registers-Unregisters and instance getter this class.
 		static void Register();
@@ -29,7 +33,16 @@ namespace GraphPrinter
 		virtual UWidgetPrinter* FindAvailableWidgetPrinter(UPrintWidgetOptions* Options) const = 0;
 		virtual UWidgetPrinter* FindAvailableWidgetPrinter(URestoreWidgetOptions* Options) const = 0;
 
+		// Prints multiple widgets while overlapping the drawing of one widget with the readback and file writing of the others.
+		// The widgets are printed as a batch job of the print job queue, so the interactive prints are started ahead of them.
+		// OnFinished is called with the number of widgets printed successfully when all widgets have been processed.
+		virtual void PrintWidgets(const TArray<UPrintWidgetOptions*>& OptionsList, const FOnPrintWidgetsFinished& OnFinished) = 0;
+
 		// Returns a data structure if the specified widget is supported by any printer.
 		virtual TOptional<FSupportedWidget> CheckIfSupported(const TSharedRef<SWidget>& TestWidget) const = 0;
+
+		// Collects instances of inherited classes of all existing UWidgetPrinter class.
+		// It is done when the editor mainframe is created, so it only needs to be called where there is no mainframe, such as in commandlets.
+		virtual void CollectWidgetPrinters() = 0;
 	};
 }
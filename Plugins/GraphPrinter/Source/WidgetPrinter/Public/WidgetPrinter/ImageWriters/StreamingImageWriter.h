@@ -0,0 +1,47 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class EDesiredImageFormat : uint8;
+
+namespace GraphPrinter
+{
+	/**
+	 * An interface class that encodes an image while receiving horizontal bands of pixels,
+	 * so that the entire image never needs to be held in memory.
+	 */
+	class WIDGETPRINTER_API IStreamingImageWriter
+	{
+	public:
+		// Creates a writer for the specified image format.
+		// Returns nullptr if the image format cannot be written in a streaming way.
+		static TSharedPtr<IStreamingImageWriter> Create(const EDesiredImageFormat ImageFormat);
+
+		// Returns whether the image format can be written in a streaming way.
+		static bool IsSupportedFormat(const EDesiredImageFormat ImageFormat);
+		
+		// Destructor.
+		virtual ~IStreamingImageWriter() = default;
+
+		// Creates the image file and writes the header of the image.
+		// The encoded metadata, such as the text chunks of a png file, is written right after the header so that it comes before the image data.
+		// If bOverwriteFile is false and the file already exists, fails in the same way as the image write queue.
+		virtual bool Open(
+			const FString& Filename,
+			const FIntPoint& ImageSize,
+			const int32 CompressionQuality,
+			const bool bOverwriteFile,
+			const TArray<uint8>& EncodedMetadata
+		) = 0;
+
+		// Encodes the pixels of the specified number of rows and writes them to the image file.
+		// The pixels must be arranged from top to bottom with the width of the image.
+		virtual bool WriteRows(const FColor* Pixels, const int32 NumRows) = 0;
+
+		// Finishes writing the image and closes the image file.
+		// If any rows have not been written, the image file is discarded.
+		virtual bool Close() = 0;
+	};
+}
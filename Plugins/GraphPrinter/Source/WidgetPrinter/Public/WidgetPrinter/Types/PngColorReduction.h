@@ -0,0 +1,23 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PngColorReduction.generated.h"
+
+/**
+ * An enum that defines how the colors of the image are reduced when writing png files.
+ * The pixels are analyzed after reading them back, and the colors are never changed.
+ */
+UENUM()
+enum class EPngColorReduction : uint8
+{
+	// Always writes 8-bit RGBA.
+	None UMETA(DisplayName = "None (RGBA)"),
+
+	// Drops the alpha channel if the image is fully opaque.
+	RemoveOpaqueAlpha UMETA(DisplayName = "Remove Opaque Alpha (RGB)"),
+
+	// In addition, writes the image with an indexed palette if it uses 256 colors or less.
+	Palette UMETA(DisplayName = "Indexed Palette"),
+};
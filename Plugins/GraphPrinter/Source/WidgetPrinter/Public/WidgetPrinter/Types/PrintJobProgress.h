@@ -0,0 +1,64 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace GraphPrinter
+{
+	// The priority of the print job. The widgets of the jobs with higher priority are started first.
+	enum class EPrintJobPriority : uint8
+	{
+		// The jobs that print many widgets in the background, such as the commandlet.
+		Batch,
+
+		// The jobs requested by the user, such as the editor commands and the remote control.
+		Interactive,
+	};
+
+	// The state of the print job.
+	enum class EPrintJobState : uint8
+	{
+		// Waiting for the widgets to be started.
+		Queued,
+
+		// Some widgets have been started.
+		Running,
+
+		// All widgets have been processed.
+		Finished,
+
+		// Cancelled before all widgets were started.
+		Cancelled,
+	};
+
+	/**
+	 * A struct that represents the progress of the print job notified to the callbacks.
+	 */
+	struct WIDGETPRINTER_API FPrintJobProgress
+	{
+	public:
+		// Returns whether the job has been finished or cancelled and will not be notified again.
+		bool IsCompleted() const;
+
+	public:
+		// The id of the job.
+		int32 JobId = INDEX_NONE;
+
+		// The state of the job.
+		EPrintJobState State = EPrintJobState::Queued;
+
+		// The number of widgets whose printing has been finished, including those that failed.
+		int32 NumFinishedWidgets = 0;
+
+		// The number of widgets that have been printed successfully.
+		int32 NumSucceededWidgets = 0;
+
+		// The number of widgets to print in the job.
+		int32 NumWidgets = 0;
+	};
+
+	// The event called when the progress of the print job changes.
+	DECLARE_DELEGATE_OneParam(FOnPrintJobProgress, const FPrintJobProgress& /* Progress */);
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnAnyPrintJobProgress, const FPrintJobProgress& /* Progress */);
+}
@@ -7,6 +7,8 @@
 #include "ImageWriteBlueprintLibrary.h"
 #include "Templates/SubclassOf.h"
 #include "GraphPrinterGlobals/GraphPrinterGlobals.h"
+#include "WidgetPrinter/Types/WidgetInfoFormat.h"
+#include "WidgetPrinter/Types/PngColorReduction.h"
 #if UE_5_02_OR_LATER
 #include "Engine/TextureDefines.h"
 #endif
@@ -56,6 +58,10 @@ public:
 
 		return Cast<TPrintOptions>(Duplicate(TPrintOptions::StaticClass()));
 	}
+
+	// Returns the text that represents the options affecting the printed image.
+	// It is hashed together with the content to print to detect changes since the last export.
+	virtual FString GetContentHashText() const;
 	
 public:
 	// The type of node range to print.
@@ -68,6 +74,9 @@ public:
 	// Whether to embed the widget information in the image file.
 	// When this option is enabled, the image formats that can be selected are limited.
 	bool bIsIncludeWidgetInfoInImageFile;
+
+	// How the widget information is stored in the text chunk of the image file.
+	EWidgetInfoFormat WidgetInfoFormat;
 #endif
 		
 	// Whether to output the drawing result affected by the gamma value.
@@ -78,6 +87,16 @@ public:
 
 	// The drawing scale of the output image.
 	float RenderingScale;
+
+	// Whether to draw widgets larger than the tile size in multiple tiles and stitch them together.
+	// Widgets drawn in tiles are not limited by MaxImageSize.
+	bool bEnableTiledRendering;
+
+	// The width and height of each tile when drawing in multiple tiles.
+	int32 TileSize;
+
+	// Whether to read the drawing result back from the GPU without blocking the game thread.
+	bool bUseAsyncReadback;
 		
 	// The texture filtering mode to use when outputting.
 	TEnumAsByte<TextureFilter> FilteringMode;
@@ -85,6 +104,12 @@ public:
 	// The options related to image output processing.
 	FImageWriteOptions ImageWriteOptions;
 
+	// How the colors of the image are reduced when writing png files.
+	EPngColorReduction PngColorReduction;
+
+	// Whether to skip printing when the content has not changed since the last export to the same output directory.
+	bool bSkipUnchangedExport;
+
 	// The directory path where the image file is output.
 	FString OutputDirectoryPath;
 
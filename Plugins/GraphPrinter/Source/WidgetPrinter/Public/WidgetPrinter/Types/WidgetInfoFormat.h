@@ -0,0 +1,22 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WidgetInfoFormat.generated.h"
+
+/**
+ * An enum that defines how the widget information is stored in the text chunk of the image file.
+ */
+UENUM()
+enum class EWidgetInfoFormat : uint8
+{
+	// Stores the text as it is. Can be read by any version of this plugin.
+	Uncompressed UMETA(DisplayName = "Uncompressed (tEXt)"),
+
+	// Compresses the text.
+	Compressed UMETA(DisplayName = "Compressed (zTXt)"),
+
+	// Encodes the text in UTF-8 and compresses it.
+	CompressedUnicode UMETA(DisplayName = "Compressed UTF-8 (iTXt)"),
+};
@@ -31,3 +31,6 @@ namespace GraphPrinter
 }
 
 #define GP_CAST_SLATE_WIDGET(ToClass, FromPtr) GraphPrinter::Private::CastSlateWidget<ToClass>(FromPtr, #ToClass)
+
+// Returns the type name of the Slate widget class in the same format as GP_CAST_SLATE_WIDGET compares.
+#define GP_SLATE_WIDGET_TYPE_NAME(Class) FName(TEXT(#Class))
@@ -0,0 +1,91 @@
+// Copyright 2020-2026 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GraphPrinterGlobals/GraphPrinterGlobals.h"
+#include "Containers/Ticker.h"
+
+namespace GraphPrinter
+{
+	/**
+	 * A class that records the hash of the content of each exported image file in a manifest file in the output directory,
+	 * so that printing can be skipped when the content has not changed since the last export.
+	 * The manifests are loaded when first used and the modified ones are written at regular intervals and on shutdown.
+	 */
+	class WIDGETPRINTER_API FExportManifest
+	{
+	public:
+		// Registers-Unregisters and instance getter this class.
+		static void Register();
+		static void Unregister();
+		static bool IsAvailable();
+		static FExportManifest& Get();
+
+	public:
+		// Constructor.
+		FExportManifest();
+
+		// Destructor.
+		~FExportManifest();
+
+		// Returns whether the image file exported from the content with the same key and hash still exists in the output directory.
+		// If it exists, returns its full path.
+		bool FindUpToDateFile(const FString& OutputDirectoryPath, const FString& Key, const FString& Hash, FString& OutFilename);
+
+		// Records the hash of the content exported to the image file in the manifest of the directory containing it.
+		void Record(const FString& Filename, const FString& Key, const FString& Hash);
+
+		// Writes all modified manifests to the files.
+		void Flush();
+
+		// Returns the hash of the text that represents the content to print.
+		static FString CalculateHash(const FString& Text);
+
+	private:
+		// An exported image file recorded in the manifest.
+		struct FEntry
+		{
+		public:
+			// The hash of the content printed to the image file.
+			FString Hash;
+
+			// The name of the image file relative to the output directory.
+			FString Filename;
+		};
+
+		// The entries recorded in the manifest file of an output directory.
+		struct FManifestFile
+		{
+		public:
+			// The entries by the key that identifies the content to print.
+			TMap<FString, FEntry> Entries;
+
+			// Whether there are entries that have not been written to the file.
+			bool bIsDirty = false;
+		};
+
+		// Returns the manifest of the output directory, loading it from the file if necessary.
+		FManifestFile& FindOrLoadManifestFile(const FString& OutputDirectoryPath);
+
+		// Returns the full path of the manifest file in the output directory.
+		static FString GetManifestFilename(const FString& OutputDirectoryPath);
+
+		// Returns the output directory path in the form used as the key of the manifests.
+		static FString NormalizeDirectoryPath(const FString& OutputDirectoryPath);
+
+		// Called at regular intervals to write the modified manifests.
+		bool HandleOnTick(float DeltaTime);
+
+	private:
+		// The manifests that have been loaded by the output directory.
+		TMap<FString, FManifestFile> ManifestFiles;
+
+		// The handle of the ticker that writes the modified manifests.
+#if UE_5_00_OR_LATER
+		FTSTicker::FDelegateHandle TickerHandle;
+#else
+		FDelegateHandle TickerHandle;
+#endif
+	};
+}
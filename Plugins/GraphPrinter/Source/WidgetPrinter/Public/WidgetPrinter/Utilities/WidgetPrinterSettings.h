@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "GraphPrinterGlobals/Utilities/GraphPrinterSettings.h"
 #include "GraphPrinterGlobals/GraphPrinterGlobals.h"
+#include "WidgetPrinter/Types/WidgetInfoFormat.h"
+#include "WidgetPrinter/Types/PngColorReduction.h"
 #include "Engine/EngineTypes.h"
 #if UE_5_02_OR_LATER
 #include "Engine/TextureDefines.h"
@@ -30,6 +32,11 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = "Image")
 	bool bIsIncludeWidgetInfoInImageFile;
 
+	// How the widget information is stored in the text chunk of the image file.
+	// Compressing it greatly reduces the file size of large graphs, but images with compressed information cannot be restored by older versions of this plugin.
+	UPROPERTY(EditAnywhere, Config, Category = "Image", meta = (EditCondition = "bIsIncludeWidgetInfoInImageFile"))
+	EWidgetInfoFormat WidgetInfoFormat;
+
 	// The desired output image format to write to disk.
 	UPROPERTY(EditAnywhere, Config, Category = "Image")
 	EDesiredImageFormat Format;
@@ -38,6 +45,11 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = "Image", meta = (UIMin = 0, UIMax = 100))
 	int32 CompressionQuality;
 
+	// How the colors of the image are reduced when writing png files.
+	// The pixels are analyzed after reading them back, and the alpha channel or the palette is only used if no color changes.
+	UPROPERTY(EditAnywhere, Config, Category = "Image")
+	EPngColorReduction PngColorReduction;
+
 	// The texture filtering mode to use when outputting.
 	UPROPERTY(EditAnywhere, Config, Category = "Image")
 	TEnumAsByte<TextureFilter> FilteringMode;
@@ -58,10 +70,50 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = "Image", meta = (ClampMin = 0.1f, ClampMax = 1.f, UIMin = 0.1f, UIMax = 1.f))
 	float RenderingScale;
 
+	// Whether to draw widgets that are larger than the tile size in multiple tiles and stitch them together.
+	// Only the render target of the tile size is allocated, so widgets larger than MaxImageSize can be drawn.
+	// This only applies to printers that support tiled drawing, such as graph editors.
+	UPROPERTY(EditAnywhere, Config, Category = "Image")
+	bool bEnableTiledRendering;
+
+	// The width and height of each tile when drawing in multiple tiles.
+	UPROPERTY(EditAnywhere, Config, Category = "Image", meta = (EditCondition = "bEnableTiledRendering", ClampMin = 256, ClampMax = 8192, UIMin = 256, UIMax = 8192))
+	int32 TileSize;
+
+	// Whether to read the drawing result back from the GPU asynchronously so that the editor does not freeze while printing.
+	// Widgets drawn in multiple tiles are always read back synchronously.
+	// This is only available in UE5.1 and later.
+	UPROPERTY(EditAnywhere, Config, Category = "Performance")
+	bool bUseAsyncReadback;
+
+	// The maximum number of widgets being printed at the same time when printing multiple widgets.
+	// While one widget is being drawn, the others are read back from the GPU and written to the file.
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", meta = (ClampMin = 1, ClampMax = 16, UIMin = 1, UIMax = 16))
+	int32 MaxConcurrentBatchPrints;
+
+	// The maximum amount of video memory (MB) that the render targets reused between prints can hold.
+	// Render targets that exceed this limit are released as soon as the print is finished.
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", meta = (ClampMin = 0, UIMin = 0, UIMax = 4096))
+	int32 RenderTargetPoolMaxMemoryMB;
+
+	// The time (seconds) until render targets that are not used by any print are released.
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", meta = (ClampMin = 0.f, UIMin = 0.f, UIMax = 600.f))
+	float RenderTargetPoolIdleTimeout;
+
+	// The time (milliseconds) per frame spent searching the editor for widgets supported by any printer.
+	// The search is continued in the next frame when it takes longer than this time.
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", meta = (ClampMin = 0.1f, UIMin = 0.1f, UIMax = 16.f))
+	float SupportedWidgetCollectionTimeBudget;
+
 	// Whether to overwrite the image if it already exists when export.
 	UPROPERTY(EditAnywhere, Config, Category = "File")
 	bool bCanOverwriteFileWhenExport;
 
+	// Whether to skip printing when the content has not changed since the last export to the same output directory.
+	// The hash of the content of each exported image file is recorded in a manifest file in the output directory.
+	UPROPERTY(EditAnywhere, Config, Category = "File")
+	bool bSkipUnchangedExport;
+
 	// The directory path where the image file is output.
 	UPROPERTY(EditAnywhere, Config, Category = "File")
 	FDirectoryPath OutputDirectory;	
@@ -10,14 +10,51 @@ class SOverlay;
 
 namespace GraphPrinter
 {
+	// The value returned from the visitor to control the walk of the widget tree.
+	enum class EWidgetWalkResult : uint8
+	{
+		// Continues to visit the children of the widget.
+		Continue,
+
+		// Skips the children of the widget and continues to visit the siblings.
+		SkipChildren,
+
+		// Stops the walk.
+		Stop,
+	};
+	
 	/**
 	 * A utility class that defines utility functions used in widget printer classes.
 	 */
 	class WIDGETPRINTER_API FWidgetPrinterUtils
 	{
 	public:
+		// Visits SearchTarget and all its children in depth-first order using an explicit stack instead of recursion.
+		// The depth of SearchTarget is 0, and widgets deeper than MaxDepth are not visited unless MaxDepth is INDEX_NONE.
+		static void WalkWidgetTree(
+			const TSharedPtr<SWidget>& SearchTarget,
+			const TFunctionRef<EWidgetWalkResult(SWidget& Widget, const int32 Depth)>& Visitor,
+			const int32 MaxDepth = INDEX_NONE
+		);
+
+		// Finds the nearest widget of each type in TypeNames from SearchTarget and its children in a single walk.
+		// OutFoundWidgets has the same number of elements as TypeNames, and contains nullptr for the types not found.
+		static void FindNearestChildWidgets(
+			const TSharedPtr<SWidget>& SearchTarget,
+			const TArray<FName>& TypeNames,
+			TArray<TSharedPtr<SWidget>>& OutFoundWidgets,
+			const int32 MaxDepth = INDEX_NONE
+		);
+
+		// Finds the nearest widget of the type from SearchTarget and its children.
+		static TSharedPtr<SWidget> FindNearestChildWidget(
+			const TSharedPtr<SWidget>& SearchTarget,
+			const FName& TypeName,
+			const int32 MaxDepth = INDEX_NONE
+		);
+		
 		// Enumerates all widgets that are children of SearchTarget.
-		// if Predicate returns false, stop recursive process.
+		// if Predicate returns false, the children of that widget are not enumerated.
 		static void EnumerateChildWidgets(
 			const TSharedPtr<SWidget>& SearchTarget,
 			const TFunction<bool(const TSharedPtr<SWidget>& ChildWidget)>& Predicate
@@ -4,7 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "WidgetPrinter/WidgetPrinters/WidgetPrinter.h"
+#include "WidgetPrinter/ImageWriters/StreamingImageWriter.h"
 #include "WidgetPrinter/Utilities/WidgetPrinterSettings.h"
+#include "WidgetPrinter/Utilities/ExportManifest.h"
 #include "GraphPrinterGlobals/GraphPrinterGlobals.h"
 #include "GraphPrinterGlobals/Utilities/GraphPrinterUtils.h"
 #include "GraphPrinterGlobals/Utilities/EditorNotification.h"
@@ -19,6 +21,7 @@
 #include "HAL/FileManager.h"
 #include "EdGraph/EdGraph.h"
 #include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
 #include "Widgets/SWidget.h"
 #include <typeinfo>
 
@@ -34,6 +37,16 @@ namespace GraphPrinter
 	public:
 		// Defines the event when receiving the drawing result without outputting the render target.
 		DECLARE_DELEGATE_OneParam(FOnRendered, UWidgetPrinter::FRenderingResult /* RenderingResult */);
+
+		// The widget information embedded in the image file when it is first written.
+		struct FWidgetInfoToEmbed
+		{
+			// The keys and values to write to the text chunk.
+			TMap<FString, FString> MapToWrite;
+
+			// How the information is stored in the text chunk.
+			EWidgetInfoFormat Format;
+		};
 		
 	public:
 		// Destructor.
@@ -44,6 +57,9 @@ namespace GraphPrinter
 	
 		// Returns whether the target widget can be printed.
 		virtual bool CanPrintWidget() const = 0;
+
+		// Returns the widget found from the search target of the print options, which is drawn when printing.
+		virtual TSharedPtr<SWidget> FindWidgetToPrint() const = 0;
 	
 		// Restores the state of the widget from the image file.
 		virtual void RestoreWidget() = 0;
@@ -53,30 +69,129 @@ namespace GraphPrinter
 		
 		// Called when the image file export process is complete.
 		virtual void OnExportRenderTargetFinished(const bool bIsSucceeded) = 0;
+
+		// Called when the process of embedding the widget information in the image file is complete.
+		virtual void OnWriteWidgetInfoFinished(const bool bIsSucceeded) = 0;
 		
 		// Sets event when receiving the drawing result without outputting the render target.
 		void SetOnRendered(const FOnRendered& InOnRendered);
 
+		// Returns whether the widget was printed successfully, which is decided when the end of processing is notified.
+		bool IsPrintSucceeded() const;
+
 	protected:
 		// Draws the widget on the render target.
+		// If bUsePooledRenderTarget is true, the render target is acquired from the pool and must be returned with ReleaseRenderTargetInternal.
+		// If bWaitForDrawing is false, returns without waiting for the GPU to finish drawing.
 		static UTextureRenderTarget2D* DrawWidgetToRenderTargetInternal(
 			const TSharedRef<SWidget>& Widget,
 			const FVector2D& DrawSize,
 			const TextureFilter FilteringMode,
 			const bool bUseGamma,
-			const float RenderingScale
+			const float RenderingScale,
+			const bool bUsePooledRenderTarget = false,
+			const bool bWaitForDrawing = true
+		);
+
+		// Creates an empty render target to draw the widget on.
+		static UTextureRenderTarget2D* CreateRenderTargetInternal(
+			const FIntPoint& Size,
+			const TextureFilter FilteringMode,
+			const bool bUseGamma
+		);
+
+		// Acquires an empty render target to draw the widget on from the pool.
+		static UTextureRenderTarget2D* AcquireRenderTargetInternal(
+			const FIntPoint& Size,
+			const TextureFilter FilteringMode,
+			const bool bUseGamma
+		);
+
+		// Returns the render target acquired from the pool so that it can be reused in the next print.
+		static void ReleaseRenderTargetInternal(UTextureRenderTarget2D* RenderTarget);
+
+		// Draws the widget on the already created render target.
+		static bool DrawWidgetToExistingRenderTargetInternal(
+			UTextureRenderTarget2D* RenderTarget,
+			const TSharedRef<SWidget>& Widget,
+			const FVector2D& DrawSize,
+			const bool bUseGamma,
+			const float RenderingScale,
+			const bool bWaitForDrawing = true
+		);
+
+		// Reads the pixels in the specified range of the render target.
+		static bool ReadRenderTargetPixelsInternal(
+			UTextureRenderTarget2D* RenderTarget,
+			const FIntRect& Rect,
+			TArray<FColor>& OutPixels
 		);
 
 		// Exports the render target that draws the graph editor to image file.
 		static void ExportRenderTargetToImageFileInternal(
 			UTextureRenderTarget2D* RenderTarget,
 			const FString& Filename,
-			const FImageWriteOptions& ImageWriteOptions
+			const FImageWriteOptions& ImageWriteOptions,
+			const EPngColorReduction PngColorReduction = EPngColorReduction::None
+		);
+
+		// Returns whether the render target can be read back without blocking the game thread.
+		static bool IsAsyncReadbackSupported();
+
+		// Exports the render target that draws the graph editor to image file after reading it back without blocking the game thread.
+		// The render target acquired from the pool is returned to the pool when the readback is finished.
+		// Returns false if the readback could not be started.
+		static bool ExportRenderTargetToImageFileAsyncInternal(
+			UTextureRenderTarget2D* RenderTarget,
+			const FString& Filename,
+			const FImageWriteOptions& ImageWriteOptions,
+			const TSharedPtr<const FWidgetInfoToEmbed>& WidgetInfoToEmbed = nullptr,
+			const EPngColorReduction PngColorReduction = EPngColorReduction::None
+		);
+
+		// Exports the pixels read from the render target to image file.
+		// If the widget information is specified, it is embedded in the encoded image before the file is written.
+		static void ExportPixelsToImageFileInternal(
+			const FIntPoint& ImageSize,
+			TArray64<FColor>&& Pixels,
+			const FString& Filename,
+			const FImageWriteOptions& ImageWriteOptions,
+			const TSharedPtr<const FWidgetInfoToEmbed>& WidgetInfoToEmbed = nullptr,
+			const EPngColorReduction PngColorReduction = EPngColorReduction::None
+		);
+
+		// Encodes the pixels and the widget information into a single png in memory on worker threads and writes it to the file once.
+		static void ExportPixelsToPngFileInternal(
+			const FIntPoint& ImageSize,
+			TArray64<FColor>&& Pixels,
+			const FString& Filename,
+			const FImageWriteOptions& ImageWriteOptions,
+			const TSharedPtr<const FWidgetInfoToEmbed>& WidgetInfoToEmbed,
+			const EPngColorReduction PngColorReduction
+		);
+
+		// Encodes the widget information as the text chunks that the streaming image writer writes before the image data.
+		// Succeeds with empty data if there is no information to embed.
+		static bool EncodeWidgetInfoToEmbedInternal(
+			const EDesiredImageFormat ImageFormat,
+			const TSharedPtr<const FWidgetInfoToEmbed>& WidgetInfoToEmbed,
+			TArray<uint8>& OutEncodedData
+		);
+
+		// Writes the widget information to the text chunk of the image file on a worker thread and notifies the result on the game thread.
+		static void WriteTextChunkAsyncInternal(
+			const FString& Filename,
+			const TMap<FString, FString>& MapToWrite,
+			const EWidgetInfoFormat Format,
+			const TFunction<void(const bool bIsSucceeded)>& OnFinished
 		);
 		
 	protected:
 		// The event when receiving the drawing result without outputting the render target.
 		FOnRendered OnRendered;
+
+		// Whether the widget was printed successfully.
+		bool bIsPrintSucceeded = false;
 	};
 
 	/**
@@ -118,18 +233,26 @@ namespace GraphPrinter
 				RestoreOptions = InRestoreOptions->Duplicate<TRestoreOptions>();
 			}
 		}
+
+		// Destructor.
+		virtual ~TInnerWidgetPrinter() override
+		{
+			ReleaseRenderTargetInternal(WidgetPrinterParams.RenderTarget.Get());
+		}
 		
 		// IInnerWidgetPrinter interface.
 		virtual void PrintWidget() override
 		{
 			if (!IsValid(PrintOptions))
 			{
+				OnPrinterProcessingFinished.ExecuteIfBound();
 				return;
 			}
 			
 			Widget = FindTargetWidget(PrintOptions->SearchTarget);
 			if (!Widget.IsValid())
 			{
+				OnPrinterProcessingFinished.ExecuteIfBound();
 				return;
 			}
 
@@ -144,25 +267,61 @@ namespace GraphPrinter
 				}
 			}
 
+			// Skips drawing and encoding if the image file exported from the same content already exists.
+			if (IsExportUpToDate())
+			{
+				bIsPrintSucceeded = true;
+				OnPrinterProcessingFinished.ExecuteIfBound();
+				return;
+			}
+
 			PreCalculateDrawSize();
 
 			if (!CalculateDrawSize(WidgetPrinterParams.DrawSize))
 			{
 				FEditorNotification::Fail(LOCTEXT("NotSelectedError", "No widget is selected."));
+				OnPrinterProcessingFinished.ExecuteIfBound();
 				return;
 			}
 
 			// Adjusts the draw size according to the rendering scale.
 			WidgetPrinterParams.DrawSize *= PrintOptions->RenderingScale;
 
+#ifdef WITH_CLIPBOARD_IMAGE_EXTENSION
+			// The image format is decided before drawing, as the drawing result may be written to the file while drawing.
+			PrepareCopyToClipboard();
+#endif
+
 			PreDrawWidget();
 
 			const bool bIsPrintableSize = IsPrintableSize();
+			const bool bShouldDrawInTiles = ShouldDrawWidgetInTiles();
+
+			// When the rows of tiles are written to the file while drawing, the file path is needed before drawing.
+			const bool bShouldWriteWhileDrawing = (
+				bIsPrintableSize &&
+				bShouldDrawInTiles &&
+				IStreamingImageWriter::IsSupportedFormat(PrintOptions->ImageWriteOptions.Format)
+			);
+			if (bShouldWriteWhileDrawing)
+			{
+				WidgetPrinterParams.Filename = CreateFilename();
+			}
+			const bool bIsValidFilename = (!bShouldWriteWhileDrawing || !WidgetPrinterParams.Filename.IsEmpty());
 
 			// Draws the widget on the render target.
-			if (bIsPrintableSize)
+			bool bIsDrawn = false;
+			if (bIsPrintableSize && bIsValidFilename)
 			{
-				WidgetPrinterParams.RenderTarget = TStrongObjectPtr<UTextureRenderTarget2D>(DrawWidgetToRenderTarget());
+				if (bShouldDrawInTiles)
+				{
+					bIsDrawn = DrawWidgetInTiles();
+				}
+				else
+				{
+					WidgetPrinterParams.RenderTarget = TStrongObjectPtr<UTextureRenderTarget2D>(DrawWidgetToRenderTarget());
+					bIsDrawn = WidgetPrinterParams.RenderTarget.IsValid();
+				}
 			}
 
 			PostDrawWidget();
@@ -189,21 +348,29 @@ namespace GraphPrinter
 						)
 					}
 				);
+				OnPrinterProcessingFinished.ExecuteIfBound();
 				return;
 			}
 
-			if (!WidgetPrinterParams.RenderTarget.IsValid())
+			// The reason why the file path is invalid has already been notified when it was created.
+			if (!bIsValidFilename)
 			{
-				FEditorNotification::Fail(LOCTEXT("DrawError", "Failed to draw to render target."));
+				OnPrinterProcessingFinished.ExecuteIfBound();
 				return;
 			}
 
-#ifdef WITH_CLIPBOARD_IMAGE_EXTENSION
-			PrepareCopyToClipboard();
-#endif
+			if (!bIsDrawn)
+			{
+				FEditorNotification::Fail(LOCTEXT("DrawError", "Failed to draw to render target."));
+				OnPrinterProcessingFinished.ExecuteIfBound();
+				return;
+			}
 
 			// Creates output options and file path and output as image file.
-			WidgetPrinterParams.Filename = CreateFilename();
+			if (!WidgetPrinterParams.bIsWrittenWhileDrawing)
+			{
+				WidgetPrinterParams.Filename = CreateFilename();
+			}
 
 			// Binds the event when the operation is completed.
 			TWeakPtr<IInnerWidgetPrinter> This = AsShared();
@@ -243,6 +410,15 @@ namespace GraphPrinter
 			const TSharedPtr<TWidget> FoundWidget = FindTargetWidget(PrintOptions->SearchTarget);
 			return FoundWidget.IsValid();
 		}
+		virtual TSharedPtr<SWidget> FindWidgetToPrint() const override
+		{
+			if (!IsValid(PrintOptions))
+			{
+				return nullptr;
+			}
+
+			return FindTargetWidget(PrintOptions->SearchTarget);
+		}
 		virtual void RestoreWidget() override
 		{
 #ifdef WITH_TEXT_CHUNK_HELPER
@@ -341,10 +517,23 @@ namespace GraphPrinter
 
 		// Performs processing before draw the widget.
 		virtual void PreDrawWidget() {}
+
+		// Returns the widget actually drawn on the render target.
+		// It can be replaced with a widget that is not displayed on the screen so that the target widget is left as it is.
+		virtual TSharedRef<SWidget> GetWidgetToDraw() const
+		{
+			return Widget.ToSharedRef();
+		}
 		
 		// Returns whether the widget size is drawable.
 		virtual bool IsPrintableSize() const
 		{
+			// When drawing in tiles, only the render target of the tile size is allocated, so the maximum size is not applied.
+			if (ShouldDrawWidgetInTiles())
+			{
+				return (WidgetPrinterParams.DrawSize.X > 0.f && WidgetPrinterParams.DrawSize.Y > 0.f);
+			}
+			
 			// Checks draw size.
 #if UE_5_01_OR_LATER
 			if (PrintOptions->MaxImageSize.ComponentwiseAllGreaterThan(FVector2D::ZeroVector))
@@ -370,14 +559,198 @@ namespace GraphPrinter
 		virtual UTextureRenderTarget2D* DrawWidgetToRenderTarget()
 		{
 			return DrawWidgetToRenderTargetInternal(
-				Widget.ToSharedRef(),
+				GetWidgetToDraw(),
 				WidgetPrinterParams.DrawSize,
 				PrintOptions->FilteringMode,
 				PrintOptions->bUseGamma,
-				PrintOptions->RenderingScale
+				PrintOptions->RenderingScale,
+				ShouldUsePooledRenderTarget(),
+				!ShouldReadbackAsynchronously()
 			);
 		}
 
+		// Returns whether to reuse the render target to draw the widget from the pool.
+		virtual bool ShouldUsePooledRenderTarget() const
+		{
+			// Since the render target is passed to the caller, it cannot be reused by other prints.
+			return (PrintOptions->ExportMethod != UPrintWidgetOptions::EExportMethod::RenderTarget);
+		}
+
+		// Returns whether to read the drawing result back from the GPU without blocking the game thread.
+		virtual bool ShouldReadbackAsynchronously() const
+		{
+			// The render target passed to the caller must be drawn when it is returned.
+			if (!PrintOptions->bUseAsyncReadback || !ShouldUsePooledRenderTarget())
+			{
+				return false;
+			}
+
+			return IsAsyncReadbackSupported();
+		}
+
+		// Returns whether this printer can draw the widget in multiple tiles.
+		virtual bool SupportsTiledDrawing() const
+		{
+			return false;
+		}
+
+		// Returns whether to draw the widget in multiple tiles instead of a single render target.
+		virtual bool ShouldDrawWidgetInTiles() const
+		{
+			if (!SupportsTiledDrawing() || !PrintOptions->bEnableTiledRendering)
+			{
+				return false;
+			}
+
+			// Since the drawing result is not stored in a single render target, it cannot be passed as it is.
+			if (PrintOptions->ExportMethod == UPrintWidgetOptions::EExportMethod::RenderTarget)
+			{
+				return false;
+			}
+
+			const float TileSize = static_cast<float>(PrintOptions->TileSize);
+			return (WidgetPrinterParams.DrawSize.X > TileSize || WidgetPrinterParams.DrawSize.Y > TileSize);
+		}
+
+		// Performs processing before draw each tile.
+		virtual void PreDrawTile(const FIntRect& TileRect) {}
+
+		// Draws the widget in multiple tiles using a single render target of the tile size and stitches the results on the CPU.
+		// If the image format can be written in a streaming way, each row of tiles is written to the file as soon as it is drawn,
+		// so that the entire image is never held in memory.
+		virtual bool DrawWidgetInTiles()
+		{
+			const FIntPoint ImageSize(
+				FMath::CeilToInt(WidgetPrinterParams.DrawSize.X),
+				FMath::CeilToInt(WidgetPrinterParams.DrawSize.Y)
+			);
+			const int32 TileSize = FMath::Max(PrintOptions->TileSize, 1);
+			
+			// Keeps the render target alive until the last tile has been read, even if it was not acquired from the pool.
+			const TStrongObjectPtr<UTextureRenderTarget2D> TileRenderTarget(
+				AcquireRenderTargetInternal(
+					FIntPoint(TileSize, TileSize),
+					PrintOptions->FilteringMode,
+					PrintOptions->bUseGamma
+				)
+			);
+			if (!TileRenderTarget.IsValid())
+			{
+				return false;
+			}
+			ON_SCOPE_EXIT
+			{
+				ReleaseRenderTargetInternal(TileRenderTarget.Get());
+			};
+
+			WidgetPrinterParams.ImageSize = ImageSize;
+
+			const TSharedPtr<IStreamingImageWriter> StreamingImageWriter = IStreamingImageWriter::Create(PrintOptions->ImageWriteOptions.Format);
+			if (StreamingImageWriter.IsValid())
+			{
+				// The widget information is written before the image data, so the image file is never rewritten after all rows have been written.
+				TArray<uint8> EncodedWidgetInfo;
+				if (!EncodeWidgetInfoToEmbedInternal(PrintOptions->ImageWriteOptions.Format, CollectWidgetInfoToEmbed(), EncodedWidgetInfo))
+				{
+					return false;
+				}
+				
+				if (!StreamingImageWriter->Open(
+					WidgetPrinterParams.Filename,
+					ImageSize,
+					PrintOptions->ImageWriteOptions.CompressionQuality,
+					PrintOptions->ImageWriteOptions.bOverwriteFile,
+					EncodedWidgetInfo
+				))
+				{
+					return false;
+				}
+			}
+			else
+			{
+				WidgetPrinterParams.Pixels.SetNumUninitialized(static_cast<int64>(ImageSize.X) * ImageSize.Y);
+			}
+			
+			TArray<FColor> TilePixels;
+			TArray<FColor> BandPixels;
+			for (int32 TileY = 0; TileY < ImageSize.Y; TileY += TileSize)
+			{
+				const int32 BandHeight = FMath::Min(TileSize, ImageSize.Y - TileY);
+				BandPixels.SetNumUninitialized(ImageSize.X * BandHeight, false);
+				
+				for (int32 TileX = 0; TileX < ImageSize.X; TileX += TileSize)
+				{
+					const FIntRect TileRect(
+						TileX,
+						TileY,
+						FMath::Min(TileX + TileSize, ImageSize.X),
+						TileY + BandHeight
+					);
+					
+					PreDrawTile(TileRect);
+					
+					// Each tile is read back before the next tile is drawn on the same render target.
+					if (!DrawWidgetToExistingRenderTargetInternal(
+						TileRenderTarget.Get(),
+						GetWidgetToDraw(),
+						FVector2D(TileSize, TileSize),
+						PrintOptions->bUseGamma,
+						PrintOptions->RenderingScale
+					))
+					{
+						return false;
+					}
+
+					// Edge tiles are drawn in full size, so only the range inside the image is read.
+					if (!ReadRenderTargetPixelsInternal(
+						TileRenderTarget.Get(),
+						FIntRect(FIntPoint::ZeroValue, TileRect.Size()),
+						TilePixels
+					))
+					{
+						return false;
+					}
+
+					const int32 TileWidth = TileRect.Width();
+					for (int32 Row = 0; Row < BandHeight; Row++)
+					{
+						FMemory::Memcpy(
+							&BandPixels[Row * ImageSize.X + TileRect.Min.X],
+							&TilePixels[Row * TileWidth],
+							TileWidth * sizeof(FColor)
+						);
+					}
+				}
+
+				if (StreamingImageWriter.IsValid())
+				{
+					if (!StreamingImageWriter->WriteRows(BandPixels.GetData(), BandHeight))
+					{
+						return false;
+					}
+				}
+				else
+				{
+					FMemory::Memcpy(
+						&WidgetPrinterParams.Pixels[static_cast<int64>(TileY) * ImageSize.X],
+						BandPixels.GetData(),
+						BandPixels.Num() * sizeof(FColor)
+					);
+				}
+			}
+
+			if (StreamingImageWriter.IsValid())
+			{
+				if (!StreamingImageWriter->Close())
+				{
+					return false;
+				}
+				WidgetPrinterParams.bIsWrittenWhileDrawing = true;
+			}
+
+			return true;
+		}
+
 		// Performs processing after draw the widget.
 		virtual void PostDrawWidget() {}
 
@@ -451,15 +824,81 @@ namespace GraphPrinter
 				RenderingResult.RenderTarget = WidgetPrinterParams.RenderTarget;
 				RenderingResult.Filename = WidgetPrinterParams.Filename;
 				OnRendered.ExecuteIfBound(RenderingResult);
+				bIsPrintSucceeded = true;
 				OnPrinterProcessingFinished.ExecuteIfBound();
 			}
+			else if (WidgetPrinterParams.bIsWrittenWhileDrawing)
+			{
+				// The image file has already been written while drawing, so just notifies the completion.
+				if (PrintOptions->ImageWriteOptions.NativeOnComplete)
+				{
+					PrintOptions->ImageWriteOptions.NativeOnComplete(true);
+				}
+			}
+			else if (WidgetPrinterParams.Pixels.Num() > 0)
+			{
+				ExportPixelsToImageFileInternal(
+					WidgetPrinterParams.ImageSize,
+					MoveTemp(WidgetPrinterParams.Pixels),
+					WidgetPrinterParams.Filename,
+					PrintOptions->ImageWriteOptions,
+					CollectWidgetInfoToEmbed(),
+					PrintOptions->PngColorReduction
+				);
+			}
 			else
 			{
+				const TSharedPtr<const FWidgetInfoToEmbed> WidgetInfoToEmbed = CollectWidgetInfoToEmbed();
+				
+				// The render target is returned to the pool by the readback when it is finished.
+				if (ShouldReadbackAsynchronously() &&
+					ExportRenderTargetToImageFileAsyncInternal(
+						WidgetPrinterParams.RenderTarget.Get(),
+						WidgetPrinterParams.Filename,
+						PrintOptions->ImageWriteOptions,
+						WidgetInfoToEmbed,
+						PrintOptions->PngColorReduction
+					))
+				{
+					WidgetPrinterParams.RenderTarget.Reset();
+					return;
+				}
+
+				if (WidgetInfoToEmbed.IsValid())
+				{
+					// Reads the pixels in the same way as UImageWriteBlueprintLibrary::ExportToDisk so that they can be encoded together with the widget information.
+					UTextureRenderTarget2D* RenderTarget = WidgetPrinterParams.RenderTarget.Get();
+					TArray<FColor> Pixels;
+					const bool bIsRead = (
+						IsValid(RenderTarget) &&
+						ReadRenderTargetPixelsInternal(RenderTarget, FIntRect(0, 0, RenderTarget->SizeX, RenderTarget->SizeY), Pixels)
+					);
+					const FIntPoint ImageSize = bIsRead ? FIntPoint(RenderTarget->SizeX, RenderTarget->SizeY) : FIntPoint::ZeroValue;
+					
+					ReleaseRenderTargetInternal(RenderTarget);
+					WidgetPrinterParams.RenderTarget.Reset();
+
+					ExportPixelsToImageFileInternal(
+						ImageSize,
+						TArray64<FColor>(MoveTemp(Pixels)),
+						WidgetPrinterParams.Filename,
+						PrintOptions->ImageWriteOptions,
+						WidgetInfoToEmbed,
+						PrintOptions->PngColorReduction
+					);
+					return;
+				}
+				
 				ExportRenderTargetToImageFileInternal(
 					WidgetPrinterParams.RenderTarget.Get(),
 					WidgetPrinterParams.Filename,
-					PrintOptions->ImageWriteOptions
+					PrintOptions->ImageWriteOptions,
+					PrintOptions->PngColorReduction
 				);
+
+				// The pixels have already been read from the render target, so it can be reused in the next print.
+				ReleaseRenderTargetInternal(WidgetPrinterParams.RenderTarget.Get());
+				WidgetPrinterParams.RenderTarget.Reset();
 			}
 		}
 
@@ -469,11 +908,15 @@ namespace GraphPrinter
 			if (!bIsSucceeded)
 			{
 				FEditorNotification::Fail(LOCTEXT("FailedOutputError", "Failed capture widget."));
+				OnPrinterProcessingFinished.ExecuteIfBound();
 				return;
 			}
 
 			if (PrintOptions->ExportMethod == UPrintWidgetOptions::EExportMethod::ImageFile)
 			{
+				// If the widget information fails to be embedded afterwards, the print is treated as failed.
+				bIsPrintSucceeded = true;
+				
 				const FString Filename = WidgetPrinterParams.Filename;
 				FEditorNotification::Success(
 					LOCTEXT("SucceededOutput", "Capture saved as"),
@@ -492,21 +935,44 @@ namespace GraphPrinter
 #ifdef WITH_TEXT_CHUNK_HELPER
 				// Embed information of widget in the output image file.
 				// When copying to the clipboard, the process is skipped.
-				if (PrintOptions->bIsIncludeWidgetInfoInImageFile &&
-					PrintOptions->ImageWriteOptions.Format == EDesiredImageFormat::PNG)
+				// If the information was embedded when the image file was written, the file does not need to be rewritten.
+				if (ShouldIncludeWidgetInfoInImageFile() && !WidgetPrinterParams.bIsWidgetInfoEmbedded)
 				{
-					if (!WriteWidgetInfoToTextChunk())
+					// The image file written while drawing is never rewritten, as the information could not be collected before the image data.
+					// Only collecting the information needs the game thread, so the other image files are rewritten on a worker thread.
+					TMap<FString, FString> MapToWrite;
+					if (WidgetPrinterParams.bIsWrittenWhileDrawing || !GetWidgetInfoForTextChunk(MapToWrite))
 					{
-						FEditorNotification::Fail(LOCTEXT("FailedEmbedWidgetInfoError", "Failed to write widget information to image file."));
+						OnWriteWidgetInfoFinished(false);
+						return;
 					}
+					
+					TWeakPtr<IInnerWidgetPrinter> This = AsShared();
+					WriteTextChunkAsyncInternal(
+						Filename,
+						MapToWrite,
+						PrintOptions->WidgetInfoFormat,
+						[This](const bool bIsSucceeded)
+						{
+							if (This.IsValid())
+							{
+								This.Pin()->OnWriteWidgetInfoFinished(bIsSucceeded);
+							}
+						}
+					);
+					return;
 				}
 #endif
+
+				// The image file is complete since the widget information does not need to be written afterwards.
+				RecordExportManifest();
 			}
 #ifdef WITH_CLIPBOARD_IMAGE_EXTENSION
 			else if (PrintOptions->ExportMethod == UPrintWidgetOptions::EExportMethod::Clipboard)
 			{
 				if (CopyImageFileToClipboard())
 				{
+					bIsPrintSucceeded = true;
 					FEditorNotification::Success(LOCTEXT("SucceededClipboardCopy", "Succeeded to copy image to clipboard."));
 				}
 				else
@@ -520,6 +986,20 @@ namespace GraphPrinter
 
 			OnPrinterProcessingFinished.ExecuteIfBound();
 		}
+		virtual void OnWriteWidgetInfoFinished(const bool bIsSucceeded) override
+		{
+			if (!bIsSucceeded)
+			{
+				FEditorNotification::Fail(LOCTEXT("FailedEmbedWidgetInfoError", "Failed to write widget information to image file."));
+			}
+			else
+			{
+				RecordExportManifest();
+			}
+
+			bIsPrintSucceeded = bIsSucceeded;
+			OnPrinterProcessingFinished.ExecuteIfBound();
+		}
 		// End of IInnerWidgetPrinter interface.
 		
 		// Copies the image file that draws the widget to clipboard.
@@ -532,8 +1012,48 @@ namespace GraphPrinter
 #endif
 		}
 
-		// Writes the drawn widget information to the text chunk.
-		virtual bool WriteWidgetInfoToTextChunk()
+		// Returns whether to embed the widget information in the output image file.
+		virtual bool ShouldIncludeWidgetInfoInImageFile() const
+		{
+#ifdef WITH_TEXT_CHUNK_HELPER
+			return (
+				PrintOptions->ExportMethod == UPrintWidgetOptions::EExportMethod::ImageFile &&
+				PrintOptions->bIsIncludeWidgetInfoInImageFile &&
+				PrintOptions->ImageWriteOptions.Format == EDesiredImageFormat::PNG
+			);
+#else
+			return false;
+#endif
+		}
+
+		// Collects the widget information before the image file is written so that the file is written only once.
+		// Returns nullptr if the information should not or could not be embedded.
+		TSharedPtr<const FWidgetInfoToEmbed> CollectWidgetInfoToEmbed()
+		{
+#ifdef WITH_TEXT_CHUNK_HELPER
+			if (!ShouldIncludeWidgetInfoInImageFile())
+			{
+				return nullptr;
+			}
+
+			// If collecting fails, the image is written without the information and the failure is notified after it has been written.
+			const TSharedRef<FWidgetInfoToEmbed> WidgetInfoToEmbed = MakeShared<FWidgetInfoToEmbed>();
+			if (!GetWidgetInfoForTextChunk(WidgetInfoToEmbed->MapToWrite))
+			{
+				return nullptr;
+			}
+			WidgetInfoToEmbed->Format = PrintOptions->WidgetInfoFormat;
+			
+			WidgetPrinterParams.bIsWidgetInfoEmbedded = true;
+			return WidgetInfoToEmbed;
+#else
+			return nullptr;
+#endif
+		}
+		
+		// Collects the drawn widget information to write to the text chunk.
+		// This is called on the game thread, and the image file is rewritten on a worker thread.
+		virtual bool GetWidgetInfoForTextChunk(TMap<FString, FString>& MapToWrite)
 		{
 			return false;
 		}
@@ -549,6 +1069,68 @@ namespace GraphPrinter
 		{
 			return true;
 		}
+
+		// Calculates the key that identifies the content to print and the hash of the content including the options.
+		// Returns false if the content cannot be hashed, in which case it is always printed.
+		virtual bool CalculateContentHash(FString& OutKey, FString& OutHash)
+		{
+			return false;
+		}
+
+		// Returns whether the image file exported from the same content as the widget to print still exists in the output directory.
+		bool IsExportUpToDate()
+		{
+			if (!PrintOptions->bSkipUnchangedExport ||
+				PrintOptions->ExportMethod != UPrintWidgetOptions::EExportMethod::ImageFile ||
+				!FExportManifest::IsAvailable())
+			{
+				return false;
+			}
+
+			if (!CalculateContentHash(WidgetPrinterParams.ContentKey, WidgetPrinterParams.ContentHash))
+			{
+				WidgetPrinterParams.ContentHash.Reset();
+				return false;
+			}
+
+			FString Filename;
+			if (!FExportManifest::Get().FindUpToDateFile(
+				PrintOptions->OutputDirectoryPath,
+				WidgetPrinterParams.ContentKey,
+				WidgetPrinterParams.ContentHash,
+				Filename
+			))
+			{
+				return false;
+			}
+
+			FEditorNotification::Success(
+				LOCTEXT("SkippedUnchangedOutput", "Capture is unchanged from"),
+				5.f,
+				TArray<FEditorNotificationInteraction>{
+					FEditorNotificationInteraction(
+						FText::FromString(Filename),
+						FSimpleDelegate::CreateLambda([Filename]()
+						{
+							FGraphPrinterUtils::OpenFolderWithExplorer(Filename);
+						})
+					)
+				}
+			);
+			return true;
+		}
+
+		// Records the hash of the printed content in the export manifest.
+		// Since the image file is skipped in the next print once it is recorded, this is called only after all writing to the file has succeeded.
+		void RecordExportManifest()
+		{
+			if (WidgetPrinterParams.ContentHash.IsEmpty() || !FExportManifest::IsAvailable())
+			{
+				return;
+			}
+
+			FExportManifest::Get().Record(WidgetPrinterParams.Filename, WidgetPrinterParams.ContentKey, WidgetPrinterParams.ContentHash);
+		}
 		
 	protected:
 		// The event that notifies the end of processing.
@@ -571,9 +1153,27 @@ namespace GraphPrinter
 
 			// The render target that holds the drawing results to be output.
 			TStrongObjectPtr<UTextureRenderTarget2D> RenderTarget = nullptr;
+
+			// The size of the image stitched from the tiles.
+			FIntPoint ImageSize = FIntPoint::ZeroValue;
+
+			// The pixels stitched from the tiles when drawing in multiple tiles.
+			TArray64<FColor> Pixels;
+
+			// Whether the image file was written while drawing in multiple tiles.
+			bool bIsWrittenWhileDrawing = false;
+
+			// Whether the widget information was embedded when the image file was written.
+			bool bIsWidgetInfoEmbedded = false;
 		
 			// The full path of the output file.
 			FString Filename;
+
+			// The key that identifies the content to print in the export manifest.
+			FString ContentKey;
+
+			// The hash of the content to print that is recorded in the export manifest after exporting.
+			FString ContentHash;
 		};
 		FWidgetPrinterParams WidgetPrinterParams;
 	};
@@ -47,21 +47,33 @@ public:
 		}
 	};
 	
+public:
+	// Defines the event when all processing of the print is finished.
+	DECLARE_DELEGATE_OneParam(FOnPrintFinished, const bool /* bIsSucceeded */);
+	
 public:
 	// Constructor.
 	UWidgetPrinter();
 	
 	// Draws and export the widget with arguments.
-	void PrintWidget(UPrintWidgetOptions* Options);
+	// OnPrintFinished is called with whether the widget was printed when all processing is finished, including when printing fails.
+	// To avoid competing with other prints, request printing from IPrintJobQueue instead of calling this directly.
+	void PrintWidget(UPrintWidgetOptions* Options, const FOnPrintFinished& OnPrintFinished = FOnPrintFinished());
 	
 	// Returns whether the target widget can be printed.
 	bool CanPrintWidget(UPrintWidgetOptions* Options);
+
+	// Returns the widget that is drawn when printing with the options, which is found from the search target.
+	TSharedPtr<SWidget> FindWidgetToPrint(UPrintWidgetOptions* Options);
 	
 	// Restores the state of the widget from the image file.
 	void RestoreWidget(URestoreWidgetOptions* Options);
 
 	// Returns whether the target widget can be restored.
 	bool CanRestoreWidget(URestoreWidgetOptions* Options);
+
+	// Returns whether the printer is in the middle of printing and cannot be reused.
+	bool IsBusy() const;
 	
 	// Returns the printer priority.
 	// Checks if the printer can be executed from the one with the highest priority.
@@ -70,6 +82,12 @@ public:
 
 	// If the specified widget can be handled by this printer, returns a data structure containing the name to be displayed in the editor UI.
 	virtual TOptional<GraphPrinter::FSupportedWidget> CheckIfSupported(const TSharedRef<SWidget>& TestWidget) const PURE_VIRTUAL(UWidgetPrinter::CheckIfSupported, return {};)
+
+	// Returns the type names of the Slate widgets that this printer handles.
+	// CheckIfSupported must only return widgets of these types, since widgets of other types are not checked against this printer when collecting the supported widgets.
+	// If it is empty, this printer is checked against widgets of all types.
+	virtual TArray<FName> GetSupportedWidgetTypeNames() const;
+	static TArray<FName> GetSupportedWidgetTypeNames(const TSubclassOf<UWidgetPrinter>& Class);
 	
 	// Generates and returns an option class with the default settings applied.
 	virtual UPrintWidgetOptions* CreateDefaultPrintOptions(
@@ -105,6 +123,9 @@ private:
 
 	// The inner printer running so that it is not destroyed.
 	TSharedPtr<GraphPrinter::IInnerWidgetPrinter> InnerPrinter;
+
+	// The event called when the printing started by PrintWidget is finished.
+	FOnPrintFinished OnPrintFinished;
 };
 
 namespace GraphPrinter
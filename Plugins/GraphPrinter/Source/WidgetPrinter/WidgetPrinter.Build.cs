@@ -31,12 +31,18 @@ public class WidgetPrinter : ModuleRules
 				"UnrealEd",
 				"MainFrame",
 				"RenderCore",
+				"RHI",
 
 				"GraphPrinterGlobals",
 				"TextChunkHelper",
 				"ClipboardImageExtension",
 			}
 		);
+
+		AddEngineThirdPartyPrivateStaticDependencies(
+			Target,
+			"zlib"
+		);
 		
 		PublicIncludePaths.AddRange(
 			new string[]